@@ -500,7 +500,125 @@ public:
    **            cos(@f$\pi@f$ u<SUP>2</SUP> / 2) and 
    **            sin(@f$\pi@f$ u<SUP>2</SUP> / 2). 
    **/
-  static Vector FresnelInt(const double& s); 
+  static Vector FresnelInt(const double& s);
+
+  /** Various method, computing the Fresnel integrals of an array
+   ** of integration lengths.
+   **
+   ** The integrals are computed by their power series, which are
+   ** polynomials in s<SUP>4</SUP> (evaluated by Horner's scheme)
+   ** multiplied by s or s<SUP>3</SUP>: twenty terms give
+   ** a truncation error smaller than 1E-17 for |@p s| @f$\leq@f$ 2,
+   ** rounding errors being smaller than 1E-14.
+   ** This is far more precise than @ref FresnelInt (1E-5), for
+   ** a similar cost: there is neither table nor branch, and
+   ** the lengths are processed by blocks, whose loops can be
+   ** vectorized by the compiler (computing several integrals
+   ** at once).
+   **
+   ** @param s        the array of integration lengths,
+   ** @param cos_int  the array of Fresnel Cosine integrals (output),
+   ** @param sin_int  the array of Fresnel Sine integrals (output),
+   ** @param nb       the number of elements of each array.
+   **
+   ** @pre  The series converge for any length @p s, but rounding
+   ** errors quickly grow for |@p s| greater than 2 (which is
+   ** the domain of @ref FresnelInt).
+   **
+   ** @see      FresnelInt, FastFresnelInt(const double&).
+   **/
+  static void FastFresnelInt(const double* s, double* cos_int,
+			     double* sin_int, const int nb) {
+    const int nbTerms = FresnelNbTerms;
+    const double *cosCoef = FresnelCoefs(false),
+      *sinCoef = FresnelCoefs(true);
+    // lengths are processed by blocks, whose inner loops have
+    // a constant size (to be vectorized)
+    static const int blockSize = 8;
+    double s2[blockSize], s4[blockSize], c[blockSize], d[blockSize];
+    for(int first = 0; first < nb; first += blockSize) {
+      const double *sb = s + first;
+      const int size = nb - first < blockSize ? nb - first : blockSize;
+      int i, n;
+      // the last block is completed with zero lengths
+      for(i = 0; i < blockSize; i++) {
+	s2[i] = i < size ? sb[i] * sb[i] : 0;   s4[i] = s2[i] * s2[i];
+	c[i] = cosCoef[nbTerms - 1];   d[i] = sinCoef[nbTerms - 1]; }
+      for(n = nbTerms - 2; n >= 0; n--)
+	for(i = 0; i < blockSize; i++) {
+	  c[i] = c[i] * s4[i] + cosCoef[n];
+	  d[i] = d[i] * s4[i] + sinCoef[n]; }
+      for(i = 0; i < size; i++) {
+	cos_int[first + i] = c[i] * sb[i];
+	sin_int[first + i] = d[i] * s2[i] * sb[i]; } }
+  } // end of void FastFresnelInt(const double*, ...)
+
+  /** Various method, computing the Fresnel integrals in a vector,
+   ** as @ref FresnelInt but far more precisely.
+   **
+   ** Its cost is the latency of the power series' evaluation:
+   ** when several integrals are needed, @ref FastFresnelInt(const
+   ** double*, double*, double*, const int) "the array version"
+   ** should be preferred.
+   **
+   ** @param s   the integration length, which should be smaller
+   **            (in absolute value) than 2.
+   **
+   ** @return    the vector whose Cartesian coordinates are
+   **            the integral, from zero to @p s, of respectively
+   **            cos(@f$\pi@f$ u<SUP>2</SUP> / 2) and
+   **            sin(@f$\pi@f$ u<SUP>2</SUP> / 2).
+   **
+   ** @see      FastFresnelInt(const double*, double*, double*,
+   **           const int).
+   **/
+  static Vector FastFresnelInt(const double& s) {
+    const double *cosCoef = FresnelCoefs(false),
+      *sinCoef = FresnelCoefs(true), s2 = s * s, s4 = s2 * s2;
+    double c = cosCoef[FresnelNbTerms - 1],
+      d = sinCoef[FresnelNbTerms - 1];
+    for(int n = FresnelNbTerms - 2; n >= 0; n--) {
+      c = c * s4 + cosCoef[n];   d = d * s4 + sinCoef[n]; }
+    return Vector(c * s, d * s2 * s); }
+
+private:
+  /// Number of terms of the Fresnel integrals' series.
+  enum { FresnelNbTerms = 20 };
+
+  /** Various method, giving the coefficients of the power series
+   ** (in s<SUP>4</SUP>) of a Fresnel integral.
+   **
+   ** @param sine  whether the Sine integral's coefficients are
+   **              wanted (rather than the Cosine's ones).
+   **
+   ** @return   the array of @ref FresnelNbTerms coefficients.
+   **
+   ** @see      FastFresnelInt.
+   **/
+  static const double* FresnelCoefs(const bool sine) {
+    static const double cosCoef[FresnelNbTerms] = {
+      1.00000000000000000e+00, -2.46740110027233978e-01,
+      2.81855008778942248e-02, -1.60488313564253549e-03,
+      5.40741338140839160e-05, -1.20009725586002882e-06,
+      1.88434991152726863e-08, -2.20227692544546630e-10,
+      1.98968579241802189e-12, -1.43091897317151983e-14,
+      8.38472970511855409e-17, -4.07998144923387789e-19,
+      1.67484761262151835e-21, -5.87789611803689199e-24,
+      1.78377831034375125e-26, -4.72722638474268125e-29,
+      1.10344568635232950e-31, -2.28592577357685325e-34,
+      4.23114164004833068e-37, -7.03953758732173314e-40 },
+      sinCoef[FresnelNbTerms] = {
+      5.23598775598298927e-01, -9.22805853580351831e-02,
+      7.24478420419700370e-03, -3.12116942354579222e-04,
+      8.44427288354525436e-06, -1.56471445009221090e-07,
+      2.10821219332145456e-09, -2.15743068058434439e-11,
+      1.73341020888748457e-13, -1.12232447879839548e-15,
+      5.98005323921040462e-18, -2.66787136284139924e-20,
+      1.01106964246672200e-22, -3.29527147790706804e-25,
+      9.33438268902099316e-28, -2.31928366772137774e-30,
+      5.09560144781068939e-33, -9.97021902550345817e-36,
+      1.74838597291023507e-38, -2.76352269849551523e-41 };
+    return( sine ? sinCoef : cosCoef ); }
 
 }; // end of class iSeeML::geom::Vector
 
@@ -13,6 +13,9 @@
 // This class needs the definition of iSeeML::rob::BasicPath. 
 #include <iSeeML/rob/BasicPath.hpp>
 
+// This class needs the definition of iSeeML::rob::LinCurvPath. 
+#include <iSeeML/rob/LinCurvPath.hpp>
+
 /** This class defines compound (or complex, or composed) paths, 
  ** which are made of a set 
  ** of @ref iSeeML::rob::BasicPath "basic paths". 
@@ -213,6 +216,55 @@ public:
     // Return the configuration in the selected piece
     return( piece(pieceNb)[arcLength] ); } // end of operator[]
 
+
+  // === Various Methods ==========================================
+
+  /** Various method, giving the configurations at an array of arc 
+   ** lengths along the path, in arrays of coordinates. 
+   **
+   ** Cf iSeeML::rob::Path::sample, which is hidden by this faster 
+   ** version: the pieces are walked through once when the arc 
+   ** lengths increase (the walk restarts from the first piece if 
+   ** an arc length decreases), and the consecutive arc lengths 
+   ** of a piece are given together to 
+   ** @ref iSeeML::rob::LinCurvPath::sample "its sampling method". 
+   **/
+  void sample(const double* s, const int nb, double* x, double* y, 
+	      double* theta, double* kappa) const { 
+    const int last = nbPieces(); 
+    int pieceNb = 1, first = 0, i; 
+    double pieceStart, pieceEnd; 
+
+    if ( (nb <= 0) || (last <= 0) )  return; 
+    pieceStart = 0;   pieceEnd = piece(pieceNb).length(); 
+    while (first < nb) { 
+      if ( (s[first] < pieceStart) && (pieceNb > 1) ) { // restart
+	pieceNb = 1;   pieceStart = 0; 
+	pieceEnd = piece(pieceNb).length(); } 
+      // search the piece of the first arc length
+      while ( (s[first] > pieceEnd) && (pieceNb < last) ) { 
+	pieceStart = pieceEnd; 
+	pieceEnd += piece(++pieceNb).length(); } 
+      // following arc lengths in the same piece
+      for(i = first + 1; (i < nb) && (s[i] >= s[i - 1]) 
+	    && ( (s[i] <= pieceEnd) || (pieceNb == last) ); i++) ; 
+      // the pieces are currently all linear curvature paths, but 
+      // the generic (slower) sampling is kept for any other one
+      const iSeeML::rob::BasicPath& aPiece = piece(pieceNb); 
+      const iSeeML::rob::LinCurvPath* linCurv = 
+	dynamic_cast<const iSeeML::rob::LinCurvPath*>(&aPiece); 
+      if (linCurv != NULL) 
+	linCurv->sample(s + first, i - first, pieceStart, x + first, 
+			y + first, theta + first, kappa + first); 
+      else 
+	for( ; first < i; first++) { 
+	  const iSeeML::rob::CurvConfig q = aPiece[s[first] - pieceStart]; 
+	  x[first] = q.position().xCoord(); 
+	  y[first] = q.position().yCoord(); 
+	  theta[first] = q.orientation();   kappa[first] = q.curvature(); } 
+      first = i; } 
+  } // end of void sample(const double*, ...) const 
+
 protected:
   // === Various Methods ==========================================
 
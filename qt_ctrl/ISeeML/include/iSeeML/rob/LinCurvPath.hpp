@@ -162,6 +162,93 @@ public:
 
   // === Various Methods ==========================================
 
+  /** Various method, giving the configurations at an array of arc 
+   ** lengths along the path, in arrays of coordinates. 
+   **
+   ** Cf iSeeML::rob::Path::sample, which is hidden by this faster 
+   ** version: circular arcs and line segments are computed 
+   ** in closed form, and clothoid arcs use 
+   ** @ref iSeeML::geom::Vector::FastFresnelInt "the array version 
+   ** of the Fresnel integrals", from the clothoid's vertex. 
+   ** If this vertex is too far for these integrals (their argument 
+   ** should be smaller than 2), @ref operator[] is used. 
+   ** Arc lengths are taken between zero and the path's 
+   ** @ref length. 
+   **/
+  void sample(const double* s, const int nb, double* x, double* y, 
+	      double* theta, double* kappa) const 
+  { sample(s, nb, 0, x, y, theta, kappa); } 
+
+  /** Various method, giving the configurations at an array of arc 
+   ** lengths, shifted by a given one, along the path. 
+   **
+   ** @param  s      the array of arc lengths, 
+   ** @param  nb     the number of arc lengths, 
+   ** @param  shift  the arc length to substract from each one 
+   **                (when the path is a piece of a compound one), 
+   ** @param  x      the array of first coordinates (output), 
+   ** @param  y      the array of second coordinates (output), 
+   ** @param  theta  the array of orientations (output), 
+   ** @param  kappa  the array of curvatures (output). 
+   **
+   ** @see    sample(const double*, const int, double*, double*, 
+   **         double*, double*) const. 
+   **/
+  void sample(const double* s, const int nb, const double& shift, 
+	      double* x, double* y, double* theta, double* kappa) const { 
+    // arguments of the Fresnel integrals are processed by blocks
+    static const int blockSize = 32; 
+    const double &x0 = start().position().xCoord(), 
+      &y0 = start().position().yCoord(), 
+      &theta0 = start().orientation(), &kappa0 = start().curvature(), 
+      &sigma = sharpness(); 
+    double arg[blockSize], cosInt[blockSize], sinInt[blockSize]; 
+    int first, i, size; 
+
+    for(i = 0; i < nb; i++) {  // orientations and curvatures
+      const double v = s[i] - shift, 
+	w = v < 0 ? 0 : v > length() ? length() : v; 
+      theta[i] = mod2pi( theta0 + (kappa0 + sigma * w / 2) * w ); 
+      kappa[i] = kappa0 + sigma * w; } 
+    if ( fabs(sigma) * sqr( length() ) < 1E-10 ) { 
+      // circular arc or line segment: the chord has the middle
+      // orientation, and its length tends to the arc length
+      const double cos0 = cos(theta0), sin0 = sin(theta0); 
+      for(i = 0; i < nb; i++) { 
+	const double v = s[i] - shift, 
+	  w = v < 0 ? 0 : v > length() ? length() : v, 
+	  half = kappa0 * w / 2, cosH = cos(half), sinH = sin(half), 
+	  chord = fabs(half) < 1E-8 ? w : sinH / kappa0 * 2; 
+	x[i] = x0 + chord * (cos0 * cosH - sin0 * sinH); 
+	y[i] = y0 + chord * (sin0 * cosH + cos0 * sinH); } 
+      return; } 
+    // clothoid arc: scale factor and vertex, whose arc length 
+    // is - vertex and orientation is thetaV 
+    const double a = sqrt( fabs(sigma) / M_PI ), vertex = kappa0 / sigma, 
+      sgn = sigma < 0 ? -1 : 1, 
+      thetaV = theta0 - kappa0 * vertex / 2, 
+      cosV = cos(thetaV) / a, sinV = sin(thetaV) / a; 
+    if ( ( fabs(a * vertex) > 2 ) 
+	 || ( fabs( a * (vertex + length()) ) > 2 ) ) { 
+      for(i = 0; i < nb; i++) {  // too far for the integrals
+	const iSeeML::rob::CurvConfig q = (*this)[ s[i] - shift ]; 
+	x[i] = q.position().xCoord();   y[i] = q.position().yCoord(); } 
+      return; } 
+    const iSeeML::geom::Vector F0 = 
+      iSeeML::geom::Vector::FastFresnelInt(a * vertex); 
+    for(first = 0; first < nb; first += blockSize) { 
+      size = nb - first < blockSize ? nb - first : blockSize; 
+      for(i = 0; i < size; i++) { 
+	const double v = s[first + i] - shift; 
+	arg[i] = a * ( vertex + (v < 0 ? 0 : v > length() ? length() : v) ); } 
+      iSeeML::geom::Vector::FastFresnelInt(arg, cosInt, sinInt, size); 
+      for(i = 0; i < size; i++) {  // rotation of the vertex's frame
+	const double dx = cosInt[i] - F0.xCoord(), 
+	  dy = sgn * ( sinInt[i] - F0.yCoord() ); 
+	x[first + i] = x0 + dx * cosV - dy * sinV; 
+	y[first + i] = y0 + dx * sinV + dy * cosV; } } 
+  } // end of void sample(const double*, ...) const 
+
 }; // end of class iSeeML::rob::LinCurvPath
 
 #endif  // end of definition 
@@ -133,6 +133,30 @@ public:
 
   // === Various Methods ==========================================
 
+  /** Various method, giving the configurations at an array of arc 
+   ** lengths along the path, in arrays of coordinates. 
+   **
+   ** This version calls @ref operator[] for each arc length: 
+   ** sub-classes hide it by faster ones (which are used if 
+   ** the path's real class is known). 
+   **
+   ** @param  s      the array of arc lengths, 
+   ** @param  nb     the number of arc lengths, 
+   ** @param  x      the array of first coordinates (output), 
+   ** @param  y      the array of second coordinates (output), 
+   ** @param  theta  the array of orientations (output), 
+   ** @param  kappa  the array of curvatures (output). 
+   **
+   ** @pre    the given arc lengths should be positive and less 
+   ** than the path's @ref length. 
+   **/
+  void sample(const double* s, const int nb, double* x, double* y, 
+	      double* theta, double* kappa) const { 
+    for(int i = 0; i < nb; i++) { 
+      const iSeeML::rob::CurvConfig q = (*this)[ s[i] ]; 
+      x[i] = q.position().xCoord();   y[i] = q.position().yCoord(); 
+      theta[i] = q.orientation();     kappa[i] = q.curvature(); } } 
+
 }; // end of class iSeeML::rob::Path
 
 #endif  // end of definition 
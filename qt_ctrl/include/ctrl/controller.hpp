@@ -13,6 +13,7 @@
 #include <QObject>
 #include <model/motion.hpp>
 #include <model/state.hpp>
+#include <model/telemetry.hpp>
 
 /** 
  ** @brief Controller is the abstract class inherited by all 
@@ -30,6 +31,13 @@ class Controller : public QObject {
   
   /// @brief Are the odometry data the first?
   bool first_odometry;
+
+  /// @brief The last state sent for display.  @since 0.3.3
+  State last_state;
+
+  /// @brief The updates waiting to be @ref pollTelemetry "read"
+  ///        by the GUI.  @since 0.3.3
+  TelemetryRing telemetry;
   
 protected:  // for the inheriting controllers...
   /// @brief The model of the motion.  @since 0.2.2
@@ -38,6 +46,19 @@ protected:  // for the inheriting controllers...
   /// @brief The time step of the controller.  @since 0.3.0
   const double time_step;
 
+  /// @brief The duration of the current cycle: the time step,
+  ///        unless the @ref ROSnode "ROS node" is event-driven.
+  /// @since 0.3.3
+  double cycle_time;
+
+  /** @brief The number of substeps of a cycle: the controllers
+   **        which integrate (e.g. the PID's) compute their
+   **        accelerations this number of times per cycle,
+   **        the velocities being sent once per cycle.
+   ** @since 0.3.3
+   **/
+  int nb_substeps;
+
   /// @brief The first date of the odometry.  @since 0.3.1
   double initial_date;
 
@@ -54,21 +75,21 @@ protected:  // for the inheriting controllers...
    **           in absolute value, with a minimum value of 1E-9).
    **/
   Controller(const MotionModel& model, const double& ts)
-    : first_odometry(true), motion_model(model),
-      time_step( fabs(ts) >= 1E-9 ? fabs(ts) : 1E-9 ) {}
+    : first_odometry(true), last_state(), motion_model(model),
+      time_step( fabs(ts) >= 1E-9 ? fabs(ts) : 1E-9 ),
+      cycle_time(time_step), nb_substeps(1) {}
   
   /** @brief Update the velocities from the fields and 
-   **        send the update signal.
+   **        give them to the GUI.
    ** @param trans_vel  the translation velocity, 
    ** @param rot_vel    the rotation velocity.
-   ** @see  moving_velocity, turning_velocity, commandsUpdated.
+   ** @see  moving_velocity, turning_velocity, pollTelemetry.
    **/
   void updateVelocities(double& trans_vel, double& rot_vel) {
     trans_vel = moving_velocity;
     rot_vel   = turning_velocity;
-    // signal the GUI to update command's display 
-    // low frequency and small data: no copy nor mutex needed!
-    commandsUpdated(trans_vel, rot_vel); 
+    // the GUI reads the command's display when it wants
+    telemetry.push( Telemetry(trans_vel, rot_vel) ); 
   }
   
   /// @brief  Are the odometry data the first?
@@ -78,6 +99,28 @@ protected:  // for the inheriting controllers...
   /// @brief Change the odometry data status (first or not).
   /// @see firstOdometry()
   void changeFirstOdometry() { first_odometry = !first_odometry; }
+
+  /** @brief Predicts the state of the robot after a substep,
+   **        if it follows the desired velocities.
+   **
+   ** The configuration is integrated with the midpoint rule.
+   **
+   ** @param state  the state of the robot,
+   ** @param dt     the duration of the substep.
+   ** @return  the predicted state, with the desired velocities.
+   ** @see moving_velocity, turning_velocity.
+   ** @since 0.3.3
+   **/
+  State predictedState(const State& state, const double& dt) const {
+    const iSeeML::rob::OrPtConfig& q = state.configuration();
+    const double theta = q.orientation() + turning_velocity * dt / 2,
+      dist = moving_velocity * dt;
+    return State( state.date() + dt, iSeeML::rob::OrPtConfig
+		  ( q.position().xCoord() + dist * cos(theta),
+		    q.position().yCoord() + dist * sin(theta),
+		    q.orientation() + turning_velocity * dt ),
+		  moving_velocity, turning_velocity );
+  } // end of State predictedState(const State&, ...) const
   
 public:
   /// @brief The destructor needs to be defined as virtual.
@@ -86,6 +129,31 @@ public:
   /// @brief  Stops the robot (i.e. sets both velocities to zero).
   /// @since 0.2.1
   const double& timeStep() const { return time_step; }
+
+  /// @brief  Gives the duration of the current cycle.
+  /// @return The duration of the current cycle.
+  /// @since 0.3.3
+  const double& cycleTime() const { return cycle_time; }
+
+  /** @brief Sets the duration of the current cycle, i.e. the elapsed
+   **        time since the previous velocities' choice.
+   ** @param dt  the duration of the current cycle.
+   ** @warning  The duration should be strictly positive (it has
+   **           a minimum value of 1E-9).
+   ** @since 0.3.3
+   **/
+  void setCycleTime(const double& dt)
+  { cycle_time = dt >= 1E-9 ? dt : 1E-9; }
+
+  /// @brief  Gives the number of substeps of a cycle.
+  /// @return The number of substeps of a cycle.
+  /// @since 0.3.3
+  int substeps() const { return nb_substeps; }
+
+  /// @brief Sets the number of substeps of a cycle.
+  /// @param nb  the number of substeps (at least one).
+  /// @since 0.3.3
+  void setSubsteps(const int nb) { nb_substeps = nb > 1 ? nb : 1; }
   
   /** @brief Handles new state of the robot.
    ** @param state  the new state of the robot, from odometry.
@@ -111,19 +179,19 @@ public:
   virtual void chooseVelocities(double& trans_vel, double& rot_vel,
 				std::ostream& log_str) = 0;
 
-  
-Q_SIGNALS:  // this requires the Q_OBJECT macro
-
-  /// @brief Update the display of the state.
-  /// @param state  The state of the robot.  @since 0.3.1
-  void stateUpdated(const State& state);
-
-  /// @brief Update the display of the controller's commands.
-  /// @param trans_vel  the translation velocity sent to ROS,
-  /// @param rot_vel    the rotation velocity sent to ROS.
-  /// @since 0.3.1
-  void commandsUpdated(const double& trans_vel,
-		       const double& rot_vel);
+  /** @brief Gives the oldest update (state or commands) not yet
+   **        read, for display (by the GUI's thread only).
+   **
+   ** The updates replace the signals @c stateUpdated and
+   ** @c commandsUpdated (before 0.3.3): the controller's thread
+   ** never waits nor allocates, and the GUI reads them
+   ** at its own rate.
+   **
+   ** @param update  the oldest update, changed only if there is one.
+   ** @return  whether there was an update.
+   ** @since 0.3.3
+   **/
+  bool pollTelemetry(Telemetry& update) { return telemetry.pop(update); }
 
 }; // end of class Controller
 
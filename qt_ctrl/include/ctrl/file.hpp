@@ -23,6 +23,10 @@
  ** @since 0.3.0
  */
 class FileCtrl : public Controller {
+  double remain_dur;   ///< Remaining duration of the accelerations.
+  double moving_acc;   ///< Current translation acceleration.
+  double turning_acc;  ///< Current rotation acceleration.
+
 protected:
   std::ifstream *input;  ///< The input stream, if any.  @since 0.2.4
 
@@ -49,7 +53,8 @@ public:
   /// @see Controller(const MotionModel&)
   FileCtrl(const MotionModel& model, const double& ts,
 	   const char* input_file_name = NULL)
-    : Controller(model, ts), input( input_file_name == NULL ? NULL :
+    : Controller(model, ts), remain_dur(0), moving_acc(0),
+      turning_acc(0), input( input_file_name == NULL ? NULL :
 				    new std::ifstream(input_file_name)
 				    ) {
    // std::cout << "Ctrl File: '" << input_file_name << "'\n";
@@ -65,9 +65,9 @@ public:
 			std::ostream& log_str) {
     motion_model.applyAccelerationFactors
       (moving_velocity, turning_velocity,
-       moving_factor, turning_factor, time_step); /*
+       moving_factor, turning_factor, cycle_time); /*
     log_str << "+(" << moving_factor << " x, " << turning_factor 
-    << " x, " << time_step << ")"; */
+    << " x, " << cycle_time << ")"; */
     updateVelocities(trans_vel, rot_vel);
   }
   
@@ -62,10 +62,14 @@ public:
   const State& getGoal() const { return goal; }
   
   /// @brief Change the oriented point which is aimed.
-  /// @param goal  the new aimed state, in the robot's frame.
-  virtual void changeGoal(const State& goal)
-  // Set the goal in local frame & ask for future set in global frame
-  { setGoal(goal); changeFirstOdometry(); }
+  /// @param goal  the new aimed state, in the robot's frame (of the
+  ///              next state, even before the first one).
+  virtual void changeGoal(const State& goal) {
+    // Set the goal in local frame & ask for future set in global frame
+    setGoal(goal);
+    if ( !firstOdometry() )
+      changeFirstOdometry();
+  }
     
 };  // end of class ReachingCtrl
 
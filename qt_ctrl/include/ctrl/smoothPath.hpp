@@ -11,8 +11,18 @@
 #ifndef QTCTRL_SMOOTH_PATH_CTRL
 #define QTCTRL_SMOOTH_PATH_CTRL
 
+#include <list>
+#include <vector>
+#include <algorithm>                // to get std::min() declaration
 #include <ctrl/reach.hpp>
 #include <iSeeML/rob/FscPath.hpp>
+#include <model/arcIndex.hpp>
+#include <model/connector.hpp>
+#include <model/fscTable.hpp>
+#include <model/fscValues.hpp>
+#include <model/globalPath.hpp>
+#include <model/replanner.hpp>
+#include <model/velocityProfile.hpp>
 
 /** @brief SmoothPathCtrl aims at reaching an oriented point 
  ** with the robot, using a smooth path generator.
@@ -20,15 +30,77 @@
  ** A smooth path reaching the aimed oriented point is computed,
  ** and followed blindly (without recomputation with respect
  **  to odometry).
+ ** Along its straight parts, a shorter path from the current
+ ** configuration is planned in a @ref Replanner "background thread",
+ ** and followed once it is ready.
  **
  ** @since 0.3.2
  */
 class SmoothPathCtrl : public ReachingCtrl {
   Q_OBJECT  // This macro is needed to handle signals
+
+  // the limits' consequences, computed once from the motion model
+  // (each controller has its own, as each model: see RobustnessEval)
+  /// @brief The maximum translation velocity.  @since 0.3.3
+  const double max_trans_vel;
+  /// @brief The distance needed to reach the maximum velocity.
+  /// @since 0.3.3
+  const double acc_dist;
+  /// @brief The distance needed to stop from the maximum velocity.
+  /// @since 0.3.3
+  const double dec_dist;
+  /// @brief The maximum curvature at maximum velocity.  @since 0.3.3
+  const double max_curv;
+  /// @brief The maximum curvature's derivative at maximum velocity.
+  /// @since 0.3.3
+  const double max_curv_deriv;
+  /// @brief The distance covered between two replannings along
+  ///        a straight part (one second at maximum velocity).
+  /// @since 0.3.3
+  const double replan_gap;
   
   iSeeML::rob::FscPath path;  ///< @brief The computed smooth path.
+  /// @brief The index of the path, rebuilt each time it changes.
+  /// @since 0.3.3
+  ArcLengthIndex path_index;
+  /// @brief The connector of the path, which allows controllers
+  ///        to plan in parallel threads.  @since 0.3.3
+  PathConnector<iSeeML::rob::FscPath> connector;
+  /// @brief The table of the paths' lengths, used to decide
+  ///        whether a new path is worth planning (built by
+  ///        the constructor, out of the control loop).  @since 0.3.3
+  std::shared_ptr<const FscLengthTable> length_table;
+  /// @brief The path with its segments, changed with the FSC path.
+  /// @since 0.3.3
+  GlobalPath global_path;
+  /// @brief The velocity profile along the global path,
+  ///        computed with it.  @since 0.3.3
+  VelocityProfile profile;
+  /// @brief The planner of the improved paths, in its own thread.
+  /// @since 0.3.3
+  Replanner replanner;
+  /// @brief The distance from which a new path can be requested
+  ///        (hysteresis of the replanning).  @since 0.3.3
+  double replan_distance;
+  /// @brief The time (in milliseconds) waited at most for a new
+  ///        path in a cycle.  @since 0.3.3
+  unsigned long replan_budget;
   double total_distance;         ///< @brief The distance to cover.
   double distance;        ///< @brief The distance already covered.
+  /// @brief The state of the previous call to chooseVelocities
+  ///        (or of the goal's setting).  @since 0.3.3
+  State prev_state;
+
+  // the aimed trajectory and its samples keep their memory from one
+  // call of getAimedTrajectory to the next one
+  /// @brief The aimed trajectory.  @since 0.3.3
+  mutable std::list<State*> traject;
+  /// @brief The arc lengths and velocities of the path's samples.
+  /// @since 0.3.3
+  mutable std::vector<double> arc_lengths, vels;
+  /// @brief The configurations and curvatures of the path's samples.
+  /// @since 0.3.3
+  mutable std::vector<double> x, y, theta, kappa;
 
   // Cf ReachingCtrl::setGoal(const State&)
   void setGoal(const State& goal);
@@ -47,19 +119,51 @@ public:
   SmoothPathCtrl(const MotionModel& model, const double& ts,
 		 const State& goal_aimed)
     // the path will be correctly set at first odometry data
-    : ReachingCtrl(model, ts, goal_aimed) {}
+    : ReachingCtrl(model, ts, goal_aimed),
+      max_trans_vel( model.maxTranslVel() ),
+      acc_dist( max_trans_vel * max_trans_vel / 2
+		/ model.maxTranslAcc() ),
+      dec_dist( - max_trans_vel * max_trans_vel / 2
+		/ model.minTranslAcc() ),
+      max_curv( model.maxRotVel() / max_trans_vel ),
+      max_curv_deriv( std::min( model.maxRotAcc(), -model.minRotAcc() )
+		      / max_trans_vel ),
+      replan_gap(max_trans_vel),
+      // (about 0.3 s at first use of these limits: not in the loop)
+      length_table( FscLengthTable::shared(max_curv, max_curv_deriv) ),
+      // waiting for a new path a quarter of the time step at most
+      replan_distance(0), replan_budget(time_step * 1000 / 4) {}
 
-  /// @brief The destructor needs to be explicitely redefined.
-  virtual ~SmoothPathCtrl() {}
+  /// @brief The destructor frees the aimed trajectory's states.
+  virtual ~SmoothPathCtrl() {
+    for(std::list<State*>::iterator it = traject.begin();
+	it != traject.end(); it++)
+      delete *it;
+  }
   
   /// @brief Get the path to the aimed oriented point.
   /// @return The path to the aimed oriented point.
-  const iSeeML::rob::Path& getPath() const;
+  const iSeeML::rob::Path& getPath() const { return global_path; }
   
   /// @brief Transform the planned path into an aimed trajectory.
   /// @return The trajectory obtained from the planned path.
   const std::list<State*>& getAimedTrajectory() const;
   
+  /** @brief Sets whether a new path is waited for until it is
+   **        planned, instead of a quarter of the time step at most.
+   **
+   ** The commands then no longer depend on the planning's duration:
+   ** a @ref MotionReplay "replay" gives the same ones as
+   ** a synchronous run, but a cycle can overrun its time step.
+   **
+   ** @param synchronous  whether the replanning is synchronous.
+   ** @since 0.3.3
+   **/
+  void setSynchronousReplanning(const bool& synchronous) {
+    replan_budget = synchronous ? Replanner::unlimited
+      : (unsigned long)(time_step * 1000 / 4);
+  }
+
   // Cf Controller::choose_velocities(double&, double&, ...)
   void chooseVelocities(double& trans_vel, double& rot_vel,
 			std::ostream&);
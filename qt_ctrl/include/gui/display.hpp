@@ -52,6 +52,10 @@ class DataWidget : public QWidget {
   ///        data.
   QLabel labels[nbLabels];
 
+  /// @brief Label displaying the timing of the @ref ROSnode::run
+  ///        "control loop".  @since 0.3.3
+  QLabel timing_label;
+
   /// @brief Window showing the motion's path and velocities.
   /// @since 0.3.1
   QtMotionGUI motion_GUI;
@@ -102,13 +106,23 @@ public:
   
   /// @brief Update the display of the state.
   /// @param state  The state of the robot.  @since 0.3.1
-  void updateState(const State& state);
+  /// @param show   Whether the labels show it (it is recorded
+  ///               anyway).  @since 0.3.3
+  void updateState(const State& state, const bool show = true);
   
   /// @brief Update the display of the controller's commands.
   /// @param trans_vel  the translation velocity sent to ROS,
   /// @param rot_vel    the rotation velocity sent to ROS.
+  /// @param show       whether the labels show them (since 0.3.3).
   /// @since 0.3.1
-  void updateCommands(const double& trans_vel, const double& rot_vel);
+  void updateCommands(const double& trans_vel, const double& rot_vel,
+		      const bool show = true);
+  
+  /// @brief Update the display of the control loop's timing.
+  /// @param timing  the timing of the control loop.  @since 0.3.3
+  void updateTiming(const LoopTiming& timing)
+  { timing_label.setText
+      ( QString::fromStdString( timing.summary() ) ); }
   
   /// @brief Adds a trajectory to the motion display.
   /// @param trajectory  the trajectory to track.
@@ -13,6 +13,7 @@
 #include <QGraphicsScene>
 #include <list> 
 #include <model/state.hpp>
+#include <gui/series.hpp>
 
 /** @brief This class shows the motion of the robot.
  **
@@ -32,7 +33,11 @@ class QtMotionGUI : public QObject {
   QGraphicsScene  rot_vel_scene;
   
   bool not_first_state;    ///< @brief Is next state the first one?
-  State last_state;        ///< @brief Last state added.
+
+  /// @brief The path, and the translation and rotation velocity
+  ///        profiles, of the current motion (owned by the scenes).
+  /// @since 0.3.3
+  SeriesItem *path_series, *trans_vel_series, *rot_vel_series;
 
 public:
   QtMotionGUI();
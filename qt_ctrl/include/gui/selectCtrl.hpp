@@ -15,6 +15,8 @@
 #include <QGroupBox>
 #include <QRadioButton>
 #include <QComboBox>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
 #include <QPushButton>
 #include <QFileDialog>
 #include <QFileInfo>
@@ -61,8 +63,13 @@ class QtCtrlSelect : public OkCancelDialog {
   /// @brief  The button displaying and changing save file.
   QPushButton save_file; 
 
-  /// @brief The controller's time step. 
-  const double time_step; 
+  /// @brief The spin box giving the controller's time step.
+  /// @since 0.3.3
+  QDoubleSpinBox time_step_box; 
+
+  /// @brief The spin box giving the controller's number of substeps.
+  /// @since 0.3.3
+  QSpinBox substeps_box; 
 
   /// @brief The motion model of the controlled robot.  
   const MotionModel&  motion_model;
@@ -78,11 +85,13 @@ public:
    **         for the future controller.
    **
    ** @param  parent  the parent widget of the dialog,
-   ** @param  tm_stp  the future controller's time step,
-   ** @param  motion  the controller motion model.
+   ** @param  tm_stp  the future controller's default time step,
+   ** @param  motion  the controller motion model,
+   ** @param  nb_sub  the future controller's default number
+   **                 of substeps (since 0.3.3).
    **/
   QtCtrlSelect(QWidget* parent, const double tm_stp,
-	       const MotionModel& motion);
+	       const MotionModel& motion, const int nb_sub = 1);
 
   
   /** @brief   Indicates whether ROS should be started.
@@ -99,7 +108,19 @@ public:
   /** @brief   Gives the selected controller, or null pointer 
    **          if the dialog was cancelled.
    ** @return  A pointer on the build controller. */
-  Controller* newController()  { return controller; }
+  Controller* newController() {
+    if (controller != NULL)  // (the number can change until then)
+      controller->setSubsteps( substeps_box.value() );
+    return controller;
+  }
+
+  /// @brief  Gives the selected time step.  @since 0.3.3
+  /// @return The selected time step.
+  double timeStep() const { return time_step_box.value(); }
+
+  /// @brief  Gives the selected number of substeps.  @since 0.3.3
+  /// @return The selected number of substeps.
+  int substeps() const { return substeps_box.value(); }
  
   /** @brief   Gives the selected controller's widget, or 
    **          null pointer if the dialog was cancelled.
@@ -123,6 +144,14 @@ private Q_SLOTS:
     
   /// @brief  Updates the button displaying the save file.
   void updateFileName();
+
+  /// @brief  Builds the controller again if the time step changed.
+  /// @since 0.3.3
+  void updateTimeStep() {
+    if ( (controller != NULL)
+	 && (controller->timeStep() != time_step_box.value()) )
+      updateCtrl();
+  }
 };  // end of class QtCtrlSelect
 
 #endif // QTCTRL_CTRL_SELECT
@@ -0,0 +1,113 @@
+/**
+ * @file /include/gui/series.hpp
+ *
+ * @brief Qt graphics item drawing a long polyline, decimated
+ *        at the screen's resolution.
+ *
+ * @date October 2026
+ **/
+
+#ifndef QTCTRL_GUI_SERIES
+#define QTCTRL_GUI_SERIES
+
+#include <vector>
+#include <QGraphicsItem>
+#include <QPainterPath>
+#include <QPen>
+
+
+/** @brief This class is a graphics item drawing a polyline which
+ **        grows (e.g. the robot's path, or a velocity profile).
+ **
+ ** Its points are kept in a buffer, and drawn as one painter path,
+ ** decimated at the resolution of the view: a time series keeps,
+ ** for each pixel column, its first, minimal, maximal and last
+ ** points; a curve drops the points closer than a pixel from
+ ** the previous kept one.  When the buffer is full, it is
+ ** @ref compact "compacted" the same way, and the next points are
+ ** decimated as much when they are @ref append "added" (their
+ ** @ref stride "stride" doubles): memory and paint time are bounded,
+ ** whatever the number of added points, and the polyline keeps
+ ** a uniform density of points.
+ **
+ ** @since 0.3.3
+ **/
+class SeriesItem : public QGraphicsItem {
+public:
+  /// @brief The kinds of polylines.
+  enum Kind {
+    curve,       ///< Any curve (e.g. a path).
+    timeSeries,  ///< A function of the abscissa (e.g. of the time).
+  };
+
+  /// @brief The maximum number of points of the buffer.
+  static const int max_points = 1 << 14;
+
+private:
+  const Kind kind;               ///< @brief The kind of polyline.
+  QPen pen;                      ///< @brief The drawing pen.
+  std::vector<QPointF> points;   ///< @brief The points' buffer.
+  QRectF bounds;                 ///< @brief The points' bounds.
+  /// @brief The number of added points per kept one (per kept pair
+  ///        of a time series, two points being kept from twice this
+  ///        number), doubled by each @ref compact "compaction".
+  size_t stride;
+  /// @brief The number of added points in the last group, whose
+  ///        kept points are the last ones of the buffer (zero when
+  ///        the next point begins a new group).
+  size_t nb_pending;
+
+  /// @brief The decimated path, kept while the points and the level
+  ///        of detail do not change.
+  QPainterPath path;
+  qreal path_detail;             ///< @brief Its level of detail.
+  size_t path_size;              ///< @brief Its number of points.
+  /// @brief The indexes of its points (kept between the builds).
+  std::vector<size_t> path_kept;
+
+  /// @brief Halves the number of points (min/max of each four points
+  ///        of a time series, one point out of two of a curve),
+  ///        doubles the stride and computes the bounds again.
+  void compact();
+
+public:
+  /** @brief The constructor sets the kind of polyline and the pen.
+   ** @param knd  the kind of polyline,
+   ** @param pn   the drawing pen.
+   **/
+  SeriesItem(const Kind knd, const QPen& pn);
+
+  /** @brief Adds a point at the end of the polyline, decimated
+   **        by the @ref stride "stride" as the compacted ones: the
+   **        last point of a curve's group, the minimum and maximum
+   **        (in their order) of a time series' group.
+   ** @param point  the new point (its abscissa should not decrease
+   **               for a time series).
+   **/
+  void append(const QPointF& point);
+
+  /// @brief Gives the number of points of the buffer.
+  /// @return  the number of points of the buffer.
+  size_t size() const { return points.size(); }
+
+  /** @brief Gives the indexes of the points drawn at a given
+   **        level of detail.
+   ** @param kind    the kind of polyline,
+   ** @param points  the points of the polyline,
+   ** @param detail  the level of detail (pixels per scene unit),
+   ** @param kept    the indexes of the drawn points (output).
+   **/
+  static void decimate(const Kind kind,
+		       const std::vector<QPointF>& points,
+		       const qreal& detail, std::vector<size_t>& kept);
+
+  // Cf QGraphicsItem::boundingRect()
+  QRectF boundingRect() const;
+
+  // Cf QGraphicsItem::paint(QPainter*, ...)
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+	     QWidget* widget = 0);
+
+}; // end of class SeriesItem
+
+#endif // QTCTRL_GUI_SERIES
@@ -10,22 +10,20 @@
 #define QTCTRL_GUI
 
 
+#include <vector>
 #include <QMainWindow>
 #include <QMenuBar>
 #include <QToolBar>
 #include <QAction>
 #include <QProcess>
 #include <QListView>
+#include <QTimer>
 #include <QEvent>
 #include <ctrl/smoothPath.hpp>
+#include <model/fixedMotion.hpp>
 #include <gui/ctrlWdgt.hpp>
 #include <gui/display.hpp>
 
-// State class is used as parameters in this GUI's slots.
-// This macro is needed before the call to qRegisterMetaType in
-// the constructor.
-Q_DECLARE_METATYPE(State) 
-
 /** @brief This class is the @ref refs_qt_mainwindow "Qt main window" 
  **        of <tt>@ref index "qt_ctrl"</tt> package.
  **
@@ -95,8 +93,15 @@ class QtCtrlGUI : public QMainWindow {
     
   }; // end of class ROSserveur
 
-  /// @brief The default time step.  @since 0.3.1
-  static const double time_step; 
+  /** @brief The default time step of the controllers (0.2 s,
+   **        or given by @c --time-step on the command line).
+   ** @since 0.3.1 (constant before 0.3.3)
+   **/
+  double time_step; 
+
+  /// @brief The default number of substeps of the controllers
+  ///        (one, or given by @c --substeps).  @since 0.3.3
+  int nb_substeps; 
 
   /// @brief The @ref refs_qt_menubar "menu bar" of this GUI.
   /// @since 0.2.1
@@ -134,7 +139,8 @@ class QtCtrlGUI : public QMainWindow {
 
   
   /// @brief The motion model of the controlled robot.  @since 0.2.2
-  MotionModel   motion_model;
+  /// Its limits are fixed since 0.3.3.
+  FixedMotionModel<QtCtrlLimits>   motion_model;
 
   /// @brief The controller of the @ref ROSnode "ROS node" can change.
   /// @since 0.3.0
@@ -154,22 +160,26 @@ class QtCtrlGUI : public QMainWindow {
   /// @brief The @ref refs_qt_listview "Qt list view" showing 
   ///        the logs of the @ref ROSnode "ROS node".
   QListView     logs;
+
+  /// @brief The timer updating the display of the loop's timing
+  ///        (once per second).  @since 0.3.3
+  QTimer        timing_timer;
+
+  /// @brief The timer adding the new messages to the logs (five
+  ///        times per second at most).  @since 0.3.3
+  QTimer        log_timer;
+
+  /// @brief The timer reading the controller's updates (at the
+  ///        display's rate).  @since 0.3.3
+  QTimer        telemetry_timer;
+
+  /// @brief The controller's updates read by @ref updateTelemetry
+  ///        (kept between the calls: no allocation).  @since 0.3.3
+  std::vector<Telemetry> telemetry_updates;
   
   void readSettings();   ///< Load up Qt program settings at startup.
   void writeSettings();  ///< Save Qt program settings when closing.
   
-  /// @brief Connects the controller signals to this class' methods.
-  ///
-  /// This has to be donne each time the controller is changed.
-  void connectCtrl() {
-    connect( controller, SIGNAL( stateUpdated(const State&) ),
-	     this, SLOT( updateState(const State&) ) );
-    connect( controller,
-	     SIGNAL( commandsUpdated(const double&, const double&) ),
-	     this, SLOT( updateCommands(const double&, const double&)
-			 ) );
-  }
-  
 public:
   /** @brief The constructor requires <tt>main()</tt>'s arguments 
    **        (they can be forwarded by the @ref ROSnode "ROS node" 
@@ -245,24 +255,25 @@ private Q_SLOTS:
   /// @brief Method activated when this GUI's log view is updated.
   void updateLogging() { logs.scrollToBottom(); }
 
-  /// @brief Update the display of the state.
-  /// @param state  The state of the robot.  @since 0.3.1
-  void updateState(const State& state)
-  { ctrl_wdgt->updateState(state); display.updateState(state); } 
+  /// @brief Update the display of the loop's timing.  @since 0.3.3
+  void updateTiming()
+  { display.updateTiming( ctrl_node.loopTiming() ); }
+
+  /** @brief Update the display of the state and of the commands,
+   **        from the controller's updates.
+   **
+   ** Each update is recorded (history and output file), only the
+   ** last ones are shown.  This replaces the connections of
+   ** the controller's signals (before 0.3.3).
+   ** @since 0.3.3
+   **/
+  void updateTelemetry();
 
   /// @brief Update the display of the .  @since 0.3.2
   void updateTrajectory()
   { display.addTrajectory( ( (SmoothPathCtrl*)(controller) )
 			   ->getAimedTrajectory() ); } 
 
-  /// @brief Update the display of the controller's commands.
-  /// @param trans_vel  the translation velocity sent to ROS,
-  /// @param rot_vel    the rotation velocity sent to ROS.
-  /// @since 0.3.1
-  void updateCommands(const double& trans_vel, const double& rot_vel)
-  { ctrl_wdgt->updateCommands(trans_vel, rot_vel);
-    display.updateCommands(trans_vel, rot_vel); } 
-
 }; // end of class QtCtrlGUI
 
 #endif // QTCTRL_GUI
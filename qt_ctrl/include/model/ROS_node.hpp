@@ -11,13 +11,23 @@
 
 #include <string>
 #include <fstream>
+#include <chrono>
 #include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
 #include <QStringListModel>
 #include <ctrl/controller.hpp>
+#include <model/tripleBuffer.hpp>
+#include <model/latency.hpp>
+#include <model/logRing.hpp>
+#include <model/realtime.hpp>
+#include <model/recorder.hpp>
+#include <model/estimator.hpp>
 // To workaround boost/qt4 problems that won't be bugfixed. Refer to
 //    https://bugreports.qt.io/browse/QTBUG-22829
 #ifndef Q_MOC_RUN
 #include <ros/ros.h>
+#include <ros/callback_queue.h>
 #include <tf/tf.h>
 //#include <boost/python.hpp>
 #endif
@@ -69,14 +79,122 @@ class ROSnode : public QThread {
    ** See @ref refs_ros_subscriber.
    **/
   ros::Subscriber   odom_subscriber;
+
+  /** @brief ROS queue of the odometry's callbacks, served by
+   **        @ref odom_spinner instead of the main loop.
+   ** @since 0.3.3
+   **/
+  ros::CallbackQueue odom_queue;
+
+  /** @brief ROS thread calling the odometry's callbacks as soon
+   **        as data arrive (NULL while not connected).
+   **
+   ** See @ref refs_ros_asyncspinner.
+   ** @since 0.3.3
+   **/
+  ros::AsyncSpinner* odom_spinner;
+
+  /// @brief A state from odometry, with the date of its data.
+  /// @since 0.3.3
+  struct StampedState {
+    State     state;  ///< @brief The state.
+    ros::Time stamp;  ///< @brief The date of the odometry data.
+  };
+
+  /** @brief The last state from odometry, given by the odometry's
+   **        thread to the @ref run "main loop" without lock.
+   ** @since 0.3.3
+   **/
+  TripleBuffer<StampedState> odom_state;
+
+  /** @brief The real-time options of the @ref run "main loop",
+   **        read from the private ROS parameters @c realtime,
+   **        @c rt_cpu and @c rt_priority (e.g. given on the command
+   **        line as <tt>_realtime:=true _rt_cpu:=1</tt>).
+   ** @since 0.3.3
+   **/
+  RealTimeOptions rt_options;
+
+  /** @brief Whether the @ref run "main loop" is event-driven, i.e.
+   **        chooses the velocities as soon as odometry data arrive,
+   **        instead of once per time step (read from the private ROS
+   **        parameter @c event_driven).
+   **
+   ** The cycles are then at least @ref min_period apart, and the
+   ** time step is a watchdog: without odometry, a cycle starts
+   ** anyway a time step after the previous one.  The controller is
+   ** given the @ref Controller::setCycleTime "elapsed time".
+   ** @since 0.3.3
+   **/
+  bool event_driven;
+
+  /// @brief The minimum duration of an event-driven cycle, in seconds
+  ///        (private ROS parameter @c min_period, a quarter of
+  ///        the time step by default).  @since 0.3.3
+  double min_period;
+
+  /// @brief The mutex of @ref odom_arrived.  @since 0.3.3
+  QMutex odom_mutex;
+
+  /** @brief Wakes the event-driven @ref run "main loop" up
+   **        when odometry data arrive.
+   **
+   ** See @ref refs_qt_waitcondition.
+   ** @since 0.3.3
+   **/
+  QWaitCondition odom_arrived;
+
+  /** @brief The timing of the @ref run "main loop", recorded at each
+   **        cycle, read by the @ref QtCtrlGUI "GUI" and logged
+   **        by @ref end.
+   ** @since 0.3.3
+   **/
+  LoopTiming timing;
+
+  /** @brief The recorder of the states and commands of the
+   **        @ref run "main loop" (and of the goal of a reaching
+   **        controller), writing into the file given by the private
+   **        ROS parameter @c record (if any).
+   ** @since 0.3.3
+   **/
+  MotionRecorder recorder;
+
+  /** @brief The estimator between the odometry and the controller
+   **        (NULL if the odometry is given directly), chosen by
+   **        the private ROS parameter @c estimator (@c ekf for an
+   **        @ref UnicycleEKF "extended Kalman filter").
+   **
+   ** The @ref run "main loop" then gives the controller the state
+   ** predicted at the date of each cycle.
+   ** @since 0.3.3
+   **/
+  StateEstimator* estimator;
   
   /** @brief Qt object used to show the logs 
    **        in the @ref QtCtrlGUI "GUI".
    **
+   ** It only keeps the last @ref max_log_rows rows, and is only
+   ** changed by @ref flushLogs (in the GUI's thread).
+   **
    ** See  @ref refs_qt_stringlistmodel.
    **/
   QStringListModel log_model;
 
+  /// @brief The maximum number of rows of the @ref log_model
+  ///        "logs' model".  @since 0.3.3
+  static const int max_log_rows = 1000;
+
+  /** @brief The messages written by @ref log, waiting
+   **        to be @ref flushLogs "added" to the @ref log_model
+   **        "logs' model".
+   ** @since 0.3.3
+   **/
+  LogRing log_ring;
+
+  /// @brief The number of dropped messages already signaled
+  ///        in the logs.  @since 0.3.3
+  unsigned long log_dropped;
+
   /** @brief Common part of the two initialisation methods.
    ** @param ctrl  the motion controller.
    ** See  @ref refs_ros_ros, @ref refs_ros_publisher, 
@@ -85,11 +203,22 @@ class ROSnode : public QThread {
    **/
   void ROSsetup(Controller& ctrl);
 
-  /// @brief Sends the odometry data to the controller.
+  /// @brief Gives the odometry data to the @ref run "main loop",
+  ///        which sends them to the controller.
   /// @param odom  the new odometry data.
   /// @see Controller::newState().
   void newOdometry(const nav_msgs::Odometry::ConstPtr& odom);
 
+  /** @brief Waits for new odometry data, in the @ref event_driven
+   **        "event-driven" @ref run "main loop".
+   ** @param deadline  the date when the waiting stops anyway
+   **                  (the watchdog).
+   ** @return  whether new data arrived before the deadline.
+   ** @since 0.3.3
+   **/
+  bool waitOdometry
+  (const std::chrono::steady_clock::time_point& deadline);
+
 protected:
   /** @brief  Main loop of the process (on a separate thread).
    **
@@ -114,7 +243,9 @@ public:
    ** @see init().
    **/
   ROSnode(const int argc, char** argv) 
-    : ROS_argc(argc), ROS_argv(argv), motion_ctrl(NULL) {}
+    : ROS_argc(argc), ROS_argv(argv), motion_ctrl(NULL),
+      odom_spinner(NULL), event_driven(false), min_period(0),
+      estimator(NULL), log_dropped(0) {}
   
   /** @brief Stops ROS if it has been started.
    **
@@ -146,21 +277,51 @@ public:
   void init(const std::string &master_url,
 	    const std::string &host_url, Controller& ctrl);
 
+  /// @brief   The timing of the main loop, which can be read
+  ///          while it runs.
+  /// @return  The timing of the main loop.  @since 0.3.3
+  const LoopTiming& loopTiming() const { return timing; }
+
   /// @brief   The Qt object used to show the logs.
   /// @return  A reference to the @ref refs_qt_stringlistmodel 
   ///          "Qt object" used to show the logs.
   QStringListModel& loggingModel() { return log_model; }
 
   /** @brief  Writes a message at given level in the log.
+   **
+   ** The message is added to ROS log and to the
+   ** @ref loggingModel "logs' model" by the next call to
+   ** @ref flushLogs: this method neither allocates memory nor waits
+   ** (it only pushes the message into a @ref LogRing "log ring"),
+   ** but should only be called by @ref run "the main loop" while
+   ** it runs (or by another thread when it does not).
    **
    ** @param level  the log's severity level,
-   ** @param msg    the message.
+   ** @param msg    the message (truncated if too long for
+   **               a @ref LogRing "log ring").
+   **
+   ** See  @ref refs_ros_time, connected(), flushLogs().
+   **/
+  void log(const LogLevel &level, const char* msg);
+
+  /// @brief  Writes a message at given level in the log.
+  /// @param level  the log's severity level,
+  /// @param msg    the message.
+  /// @see log(const LogLevel&, const char*).
+  void log(const LogLevel &level, const std::string &msg)
+  { log( level, msg.c_str() ); }
+
+public Q_SLOTS:
+  /** @brief  Adds the messages written since the last call
+   **         to ROS log and to the @ref loggingModel "logs' model"
+   **         (in the GUI's thread), and removes the oldest rows
+   **         of the latter if needed.
    **
-   ** See  @ref refs_ros_console, @ref refs_ros_time, 
-   **      @ref refs_qt_stringlistmodel, connected(), 
-   **      loggingModel(), loggingUpdated().
+   ** See  @ref refs_ros_console, @ref refs_qt_stringlistmodel,
+   **      loggingUpdated().
+   ** @since 0.3.3
    **/
-  void log(const LogLevel &level, const std::string &msg);
+  void flushLogs();
 
 Q_SIGNALS:  // this requires the Q_OBJECT macro
   /// @brief   Signals the @ref QtCtrlGUI "GUI" for log's update.
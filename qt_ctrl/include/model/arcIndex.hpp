@@ -0,0 +1,139 @@
+/**
+ ** @file  include/model/arcIndex.hpp
+ **
+ ** @brief Index of the pieces of a compound path by arc length.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_ARC_INDEX
+#define QTCTRL_ARC_INDEX
+
+#include <vector>
+#include <algorithm>
+#include <iSeeML/rob/CompoundPath.hpp>
+
+
+/**
+ ** @brief ArcLengthIndex gives the configurations along a compound
+ **        path without walking through its pieces.
+ **
+ ** iSeeML::rob::CompoundPath::operator[] looks for the piece
+ ** containing the arc length from the first one, with two virtual
+ ** calls per piece.  This index is built once per path: it keeps
+ ** the pieces and the arc length at the end of each of them.
+ ** A configuration is then found by a binary search (@ref operator[]),
+ ** or in amortized constant time by a cursor when the arc lengths
+ ** increase (@ref next), as along a trajectory.
+ **
+ ** @warning The index keeps pointers on the path's pieces: it should
+ **          be @ref build "rebuilt" each time the path changes.
+ **          The cursor is changed by the (constant) @ref next method,
+ **          which should thus not be called by concurrent threads.
+ **          An empty index (not built, or built from a path without
+ **          any piece) gives the default configuration (the origin,
+ **          with a null curvature) at any arc length.
+ **
+ ** @since 0.3.3
+ */
+class ArcLengthIndex {
+  /// @brief The pieces of the indexed path.
+  std::vector<const iSeeML::rob::BasicPath*> pieces;
+  /// @brief The arc length at the end of each piece.
+  std::vector<double> ends;
+  /// @brief The index of the piece of the last @ref next call.
+  mutable int cursor;
+
+  /** @brief Gives the configuration at the given arc length
+   **        in the given piece.
+   **
+   ** @param id  the index of the piece (-1 if the index is empty),
+   ** @param s   the arc length along the indexed path.
+   **
+   ** @return  the configuration at the given arc length, or
+   **          the default configuration if the index is empty.
+   **/
+  iSeeML::rob::CurvConfig at(const int id, const double& s) const {
+    if (id < 0)  // empty index: no piece, not even a start
+      return iSeeML::rob::CurvConfig();
+    return (*pieces[id])[ id > 0 ? s - ends[id - 1] : s ];
+  }
+
+public:
+  /// @brief The default constructor gives an empty index,
+  ///        which should be @ref build "built" before any use.
+  ArcLengthIndex() : cursor(0) {}
+
+  /// @brief The constructor builds the index of a path.
+  /// @param path  the indexed path.
+  ArcLengthIndex(const iSeeML::rob::CompoundPath& path) : cursor(0)
+  { build(path); }
+
+  /** @brief (Re)builds the index of a path.
+   **
+   ** @param path  the indexed path (its pieces should not change
+   **               while the index is used).
+   **/
+  void build(const iSeeML::rob::CompoundPath& path) {
+    const int nb_pieces = path.nbPieces();
+    double length = 0;
+
+    pieces.resize(nb_pieces);
+    ends.resize(nb_pieces);
+    for(int id = 0; id < nb_pieces; id++) {
+      pieces[id] = &path.piece(id + 1);
+      length += pieces[id]->length();
+      ends[id] = length;
+    } // end of for (each piece)
+    cursor = 0;
+  } // end of void build(const iSeeML::rob::CompoundPath&)
+
+  /// @brief Gives the length of the indexed path.
+  /// @return  the length of the indexed path.
+  double length() const { return ends.empty() ? 0 : ends.back(); }
+
+  /** @brief Gives the configuration at a given arc length,
+   **        by a binary search of its piece.
+   **
+   ** @param s  the arc length, which should be positive and less
+   **            than the path's @ref length.
+   **
+   ** @return  the configuration at the given arc length, the same
+   **          as iSeeML::rob::CompoundPath::operator[].
+   **/
+  iSeeML::rob::CurvConfig operator[](const double& s) const {
+    // first piece ending after (or at) the arc length, or the last
+    const int last = ends.size() - 1,
+      id = std::lower_bound(ends.begin(), ends.end(), s) - ends.begin();
+    return at(id < last ? id : last, s);
+  } // end of iSeeML::rob::CurvConfig operator[](const double&) const
+
+  /** @brief Gives the configuration at a given arc length, starting
+   **        the search of its piece from the previous call's one.
+   **
+   ** When the arc lengths of successive calls increase, the cursor
+   ** goes through each piece once: the cost of a call is constant
+   ** in average.  A smaller arc length falls back
+   ** to the @ref operator[] "binary search".
+   **
+   ** @param s  the arc length, which should be positive and less
+   **            than the path's @ref length.
+   **
+   ** @return  the configuration at the given arc length.
+   **/
+  iSeeML::rob::CurvConfig next(const double& s) const {
+    const int last = ends.size() - 1;
+    if (last < 0)  // empty index
+      return at(last, s);
+    if ( (cursor > 0) && (s <= ends[cursor - 1]) )  // backward
+      cursor = std::lower_bound(ends.begin(), ends.begin() + cursor, s)
+	- ends.begin();
+    else
+      while ( (cursor < last) && (s > ends[cursor]) )
+	cursor++;
+    return at(cursor, s);
+  } // end of iSeeML::rob::CurvConfig next(const double&) const
+
+}; // end of class ArcLengthIndex
+
+#endif // QTCTRL_ARC_INDEX
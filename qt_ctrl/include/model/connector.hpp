@@ -0,0 +1,91 @@
+/**
+ ** @file  include/model/connector.hpp
+ **
+ ** @brief Thread-safe connection of Dubins-like paths.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_CONNECTOR
+#define QTCTRL_CONNECTOR
+
+#include <iSeeML/rob/DubinsLikePath.hpp>
+
+
+/**
+ ** @brief PathConnector connects Dubins-like paths using its own
+ **        array of candidate paths.
+ **
+ ** iSeeML::rob::DubinsLikePath::connect computes the candidate paths
+ ** in the array given by the virtual method @c connectArray, which
+ ** is a static array of iSeeML::rob::FscPath (or of
+ ** iSeeML::rob::DubinsPath): two threads connecting paths at the same
+ ** time overwrite each other's candidates.  A connector gives instead
+ ** its own array, by connecting a path of a sub-class which overrides
+ ** @c connectArray.  Each thread (e.g. each controller) which plans
+ ** paths should thus have its own connector, and no lock is needed.
+ **
+ ** @warning The candidate paths are kept from one connection
+ **          to the next one, but ISeeML still reallocates their
+ **          pieces at each connection: this is not allocation-free.
+ **
+ ** @param PathClass  the class of the connected paths,
+ **                   iSeeML::rob::FscPath or iSeeML::rob::DubinsPath.
+ **
+ ** @since 0.3.3
+ */
+template<class PathClass>
+class PathConnector {
+  /// @brief The number of candidate paths.
+  static const int nb_candidates
+  = iSeeML::rob::DubinsLikePath::nbPossiblePaths;
+
+  /// @brief The path being connected, which gives the connector's
+  ///        candidates instead of the static ones.
+  class ConnectedPath : public PathClass {
+    /// @brief The candidates of the connector.
+    PathClass* candidates;
+
+  public:
+    /// @brief The constructor copies the parameters of a path.
+    /// @param path   the copied path (for its parameters),
+    /// @param cands  the candidates' array of the connector.
+    ConnectedPath(const PathClass& path, PathClass* cands)
+      : PathClass(path), candidates(cands) {}
+
+  protected:
+    // Cf iSeeML::rob::DubinsLikePath::connectArray()
+    iSeeML::rob::DubinsLikePath* connectArray() const {
+      // fill the array with clones of the current path
+      for(int id = 0; id < nb_candidates; id++)
+	candidates[id] = *this;
+      return candidates;
+    }
+  }; // end of class ConnectedPath
+
+  /// @brief The candidate paths, for one connection at a time.
+  PathClass candidates[nb_candidates];
+
+public:
+  /** @brief Changes a path to the shortest one connecting two
+   **        configurations, with the same parameters.
+   **
+   ** @param path   the changed path, whose parameters
+   **                (e.g. its maximum curvature) are used,
+   **                even if it was not yet connected,
+   ** @param start  the starting configuration,
+   ** @param goal   the goal configuration.
+   **
+   ** @see iSeeML::rob::DubinsLikePath::connect
+   **/
+  void connect(PathClass& path, const iSeeML::rob::OrPtConfig& start,
+	       const iSeeML::rob::OrPtConfig& goal) {
+    ConnectedPath connected(path, candidates);
+    // once built, the path uses the connectArray method above
+    connected.connect(start, goal);
+    path = connected;
+  } // end of void connect(PathClass&, ...)
+
+}; // end of class PathConnector
+
+#endif // QTCTRL_CONNECTOR
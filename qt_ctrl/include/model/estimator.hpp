@@ -0,0 +1,119 @@
+/**
+ ** @file  include/model/estimator.hpp
+ **
+ ** @brief Online estimation of the robot's state from odometry.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_ESTIMATOR
+#define QTCTRL_ESTIMATOR
+
+#include <model/state.hpp>
+
+
+/**
+ ** @brief StateEstimator is the abstract class of the estimators
+ **        placed between the odometry and the @ref Controller
+ **        "controller", by the @ref ROSnode "ROS node".
+ **
+ ** Each odometry measure is @ref correct "fused" into the estimate,
+ ** which is then @ref predict "predicted" to the date when
+ ** the controller chooses its velocities: the odometry's transport
+ ** latency is compensated, and its noise is filtered.
+ **
+ ** @since 0.3.3
+ */
+class StateEstimator {
+public:
+  /// @brief The destructor needs to be defined as virtual.
+  virtual ~StateEstimator() {}
+
+  /// @brief Forgets the previous measures.
+  virtual void reset() = 0;
+
+  /** @brief Tells whether a measure was fused since the last
+   **        @ref reset.
+   ** @return  whether there is an estimate.
+   **/
+  virtual bool initialized() const = 0;
+
+  /** @brief Fuses a new measure into the estimate.
+   ** @param measure  the measured state (e.g. from odometry),
+   **                 with its date.
+   **/
+  virtual void correct(const State& measure) = 0;
+
+  /** @brief Gives the estimated state at a given date.
+   ** @param date  the date (usually later than the last measure's).
+   ** @return  the estimated state at this date.
+   ** @warning  There should be an estimate (see @ref initialized).
+   **/
+  virtual State predict(const double& date) const = 0;
+
+}; // end of class StateEstimator
+
+
+/**
+ ** @brief UnicycleEKF is an extended Kalman filter of the state
+ **        of a unicycle: its position, orientation and velocities.
+ **
+ ** Between measures, the velocities are constant, up to a white
+ ** noise of acceleration (the process noise).  Each odometry measure
+ ** gives the whole state, with its own noise.  Each step has a fixed
+ ** cost (five by five matrices).
+ **
+ ** @since 0.3.3
+ */
+class UnicycleEKF : public StateEstimator {
+public:
+  /// @brief The size of the estimated state: position (x and y),
+  ///        orientation, translation and rotation velocities.
+  enum { size = 5 };
+
+  /// @brief The standard deviations of the noises.
+  struct Noise {
+    double trans_acc;   ///< @brief The translation acceleration's.
+    double rot_acc;     ///< @brief The rotation acceleration's.
+    double position;    ///< @brief The measured position's.
+    double angle;       ///< @brief The measured orientation's.
+    double trans_vel;   ///< @brief The measured translation vel.'s.
+    double rot_vel;     ///< @brief The measured rotation vel.'s.
+
+    /// @brief The default constructor gives the noises of a Kobuki
+    ///        base's odometry (in SI units).
+    Noise() : trans_acc(.5), rot_acc(1), position(.01), angle(.01),
+	      trans_vel(.05), rot_vel(.05) {}
+  }; // end of struct Noise
+
+private:
+  Noise  noise;                      ///< @brief The noises.
+  double estimate[size];             ///< @brief The estimated state.
+  double covariance[size][size];     ///< @brief Its covariance.
+  double date;                       ///< @brief Its date.
+  bool   has_estimate;               ///< @brief Is there an estimate?
+
+  /// @brief Propagates the estimate and its covariance.
+  /// @param dt  the duration of the propagation.
+  void propagate(const double& dt);
+
+public:
+  /// @brief The constructor gives the noises.
+  /// @param nz  the standard deviations of the noises.
+  UnicycleEKF(const Noise& nz = Noise()) : noise(nz) { reset(); }
+
+  // Cf StateEstimator::reset()
+  void reset() { has_estimate = false;  date = 0; }
+
+  // Cf StateEstimator::initialized()
+  bool initialized() const { return has_estimate; }
+
+  // Cf StateEstimator::correct(const State&)
+  void correct(const State& measure);
+
+  // Cf StateEstimator::predict(const double&)
+  State predict(const double& when) const;
+
+}; // end of class UnicycleEKF
+
+#endif // QTCTRL_ESTIMATOR
@@ -0,0 +1,140 @@
+/**
+ * @file  include/model/fixedMotion.hpp
+ *
+ * @brief Motion model with limits fixed at compile time.
+ *
+ * @date  October 2026
+ **/
+
+#ifndef QTCTRL_FIXED_MOTION
+#define QTCTRL_FIXED_MOTION
+
+#include <model/motion.hpp>
+
+
+/** @brief The limits of the robot controlled by
+ **        the @ref QtCtrlGUI "qt_ctrl GUI".
+ **
+ ** A class of limits, to be used with @ref FixedMotionModel,
+ ** simply defines the seven limits as <tt>constexpr</tt> static
+ ** methods, with the names of @ref MotionModel's descriptive methods.
+ **
+ ** @since 0.3.3
+ **/
+struct QtCtrlLimits {
+  /// @brief The minimum translation velocity.
+  static constexpr double minTranslVel() { return -.5; }
+  /// @brief The maximum translation velocity.
+  static constexpr double maxTranslVel() { return .5; }
+  /// @brief The maximum rotation velocity.
+  static constexpr double maxRotVel()    { return M_PI / 4; }
+  /// @brief The minimum translation acceleration.
+  static constexpr double minTranslAcc() { return -.6; }
+  /// @brief The maximum translation acceleration.
+  static constexpr double maxTranslAcc() { return .5; }
+  /// @brief The minimum rotation acceleration.
+  static constexpr double minRotAcc()    { return -M_PI / 8; }
+  /// @brief The maximum rotation acceleration.
+  static constexpr double maxRotAcc()    { return M_PI / 8; }
+}; // end of struct QtCtrlLimits
+
+
+/** @brief This class defines a motion model whose limits are known
+ **        at compile time.
+ **
+ ** It is a @ref MotionModel, and can thus be given to
+ ** the controllers.  But the code which knows its exact type
+ ** (as the @ref ModelSimulator "simulator") uses the methods
+ ** below, which are inlined with the limits as constants.
+ ** The controllers only know a @c const @ref MotionModel&: they
+ ** still call the runtime model's methods, which are unchanged.
+ ** The gain is thus limited to the simulator's loop, where
+ ** the acceleration limiting is a small part of a step.
+ **
+ ** @param RobotLimits  the class of the limits, see @ref QtCtrlLimits.
+ **
+ ** @since 0.3.3
+ **/
+template<class RobotLimits>
+class FixedMotionModel : public MotionModel {
+  /// @brief Shortcut for the limits' class.
+  typedef RobotLimits L;
+
+public:
+  /// @brief The only constructor sets the limits
+  ///        of the @ref MotionModel.
+  FixedMotionModel()
+    : MotionModel(L::minTranslVel(), L::maxTranslVel(), L::maxRotVel(),
+		  L::minTranslAcc(), L::maxTranslAcc(),
+		  L::minRotAcc(), L::maxRotAcc()) {}
+
+  /// @brief Cf @ref MotionModel::applyAccelerationFactors(double&,
+  ///        double&, const double&, const double&, const double&)
+  ///        const "MotionModel::applyAccelerationFactors".
+  void applyAccelerationFactors(double& trans_vel, double& rot_vel,
+				const double& trans_fact,
+				const double& rot_fact,
+				const double& time_step) const {
+    const double t_sgn = (trans_fact < 0 ? -1 : 1),
+      t_fact = t_sgn * trans_fact,
+      r_sgn = (rot_fact < 0 ? -1 : 1), r_fact = r_sgn * rot_fact;
+    trans_vel = limitedVelocity(trans_vel, t_sgn,
+				t_fact * L::maxTranslAcc(),
+				- t_fact * L::minTranslAcc(),
+				L::minTranslVel(), L::maxTranslVel(),
+				time_step);
+    rot_vel = limitedVelocity(rot_vel, r_sgn, r_fact * L::maxRotAcc(),
+			      - r_fact * L::minRotAcc(), - L::maxRotVel(),
+			      L::maxRotVel(), time_step);
+  } // end of void applyAccelerationFactors(double&, ...) const
+
+  /// @brief Cf @ref MotionModel::applyAccelerations(double&,
+  ///        double&, const double&, const double&, const double&)
+  ///        const "MotionModel::applyAccelerations".
+  void applyAccelerations(double& trans_vel, double& rot_vel,
+			  const double& trans_acc,
+			  const double& rot_acc,
+			  const double& time_step) const {
+    const double max_a = L::maxTranslAcc(), max_d = - L::minTranslAcc(),
+      max_gm = L::maxRotAcc(), max_gd = - L::minRotAcc(),
+      t_sgn = (trans_acc < 0 ? -1 : 1), t_acc = t_sgn * trans_acc,
+      r_sgn = (rot_acc < 0 ? -1 : 1), r_acc = r_sgn * rot_acc;
+    trans_vel = limitedVelocity(trans_vel, t_sgn,
+				t_acc < max_a ? t_acc : max_a,
+				t_acc < max_d ? t_acc : max_d,
+				L::minTranslVel(), L::maxTranslVel(),
+				time_step);
+    rot_vel = limitedVelocity(rot_vel, r_sgn,
+			      r_acc < max_gm ? r_acc : max_gm,
+			      r_acc < max_gd ? r_acc : max_gd,
+			      - L::maxRotVel(), L::maxRotVel(), time_step);
+  } // end of void applyAccelerations(double&, ...) const
+
+  /// @brief Cf @ref MotionModel::applyAccelerationFactors(double*,
+  ///        double*, const double*, const double*, const int,
+  ///        const double&) const
+  ///        "MotionModel::applyAccelerationFactors".
+  void applyAccelerationFactors(double* trans_vel, double* rot_vel,
+				const double* trans_fact,
+				const double* rot_fact, const int nb,
+				const double& time_step) const {
+    for(int id = 0; id < nb; id++)
+      applyAccelerationFactors(trans_vel[id], rot_vel[id],
+			       trans_fact[id], rot_fact[id], time_step);
+  }
+
+  /// @brief Cf @ref MotionModel::applyAccelerations(double*,
+  ///        double*, const double*, const double*, const int,
+  ///        const double&) const "MotionModel::applyAccelerations".
+  void applyAccelerations(double* trans_vel, double* rot_vel,
+			  const double* trans_acc,
+			  const double* rot_acc, const int nb,
+			  const double& time_step) const {
+    for(int id = 0; id < nb; id++)
+      applyAccelerations(trans_vel[id], rot_vel[id],
+			 trans_acc[id], rot_acc[id], time_step);
+  }
+
+}; // end of class FixedMotionModel
+
+#endif // QTCTRL_FIXED_MOTION
@@ -0,0 +1,89 @@
+/**
+ ** @file  include/model/fscTable.hpp
+ **
+ ** @brief Table of the lengths of FSC paths.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_FSC_TABLE
+#define QTCTRL_FSC_TABLE
+
+#include <vector>
+#include <memory>
+#include <iSeeML/rob/FscPath.hpp>
+
+
+/**
+ ** @brief FscLengthTable gives an estimation of the length of the FSC
+ **        path connecting two configurations, without planning it.
+ **
+ ** The length of a FSC path only depends on the goal's configuration
+ ** in the frame of the start (and on the path's parameters).  Lengths
+ ** are thus planned once, in @ref BatchPlanner "parallel", on a grid
+ ** of relative positions (in a square around the start) and
+ ** orientations: an estimation is then a trilinear interpolation
+ ** between eight lengths of the grid.
+ **
+ ** @warning FSC paths' lengths are not continuous (the shortest type
+ **          can change): an estimation is only good to decide
+ **          whether the exact path is worth planning.
+ **
+ ** @since 0.3.3
+ */
+class FscLengthTable {
+  /// @brief The half size of the square of relative positions.
+  double range;
+  /// @brief The number of positions along each side of the square.
+  int nb_pos;
+  /// @brief The number of orientations (in a turn).
+  int nb_orient;
+  /// @brief The lengths, in the order of orientations, second
+  ///        and first coordinates of the relative goal.
+  std::vector<float> lengths;
+
+public:
+  /** @brief The constructor plans the lengths of the grid.
+   **
+   ** @param max_curv   the maximum curvature of the paths,
+   ** @param max_deriv  the maximum curvature's derivative,
+   ** @param rng        the half size of the square of relative
+   **                    positions,
+   ** @param nb_p       the number of positions along a side
+   **                    of the square (at least two),
+   ** @param nb_o       the number of orientations (at least one).
+   **/
+  FscLengthTable(const double& max_curv, const double& max_deriv,
+		 const double& rng, const int nb_p = 41,
+		 const int nb_o = 32);
+
+  /** @brief Gives an estimation of the length of the FSC path
+   **        connecting two configurations.
+   **
+   ** @param start  the starting configuration,
+   ** @param goal   the goal configuration.
+   **
+   ** @return  the interpolated length, or a negative value
+   **          if the relative goal is out of the table's square.
+   **/
+  double length(const iSeeML::rob::OrPtConfig& start,
+		const iSeeML::rob::OrPtConfig& goal) const;
+
+  /** @brief Gives the table of the given parameters, shared by all
+   **        its users: it is built at the first call only.
+   **
+   ** The table's square has a half size of eight turning radii
+   ** (see iSeeML::rob::FscPath::computeValues).
+   ** This method can be called from several threads.
+   **
+   ** @param max_curv   the maximum curvature of the paths,
+   ** @param max_deriv  the maximum curvature's derivative.
+   **
+   ** @return  the table of the given parameters.
+   **/
+  static std::shared_ptr<const FscLengthTable>
+  shared(const double& max_curv, const double& max_deriv);
+
+}; // end of class FscLengthTable
+
+#endif // QTCTRL_FSC_TABLE
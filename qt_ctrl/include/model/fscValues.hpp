@@ -0,0 +1,77 @@
+/**
+ ** @file  include/model/fscValues.hpp
+ **
+ ** @brief Memoized values of the FSC paths.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_FSC_VALUES
+#define QTCTRL_FSC_VALUES
+
+#include <math.h>                   // to get fabs() declaration
+#include <iSeeML/rob/FscPath.hpp>
+
+
+/**
+ ** @brief FscValues are the values which iSeeML::rob::FscPath
+ **        computes from its limits (see
+ **        iSeeML::rob::FscPath::computeValues).
+ **
+ ** The limits of a robot do not change: the values of the last
+ ** limits are kept by each thread, and given without computation
+ ** nor lock when the same limits are asked again.
+ **
+ ** @since 0.3.3
+ */
+struct FscValues {
+  double max_curv;    ///< @brief The maximum curvature.
+  double max_deriv;   ///< @brief The maximum curvature's derivative.
+  double lim_defl;    ///< @brief The limit deflection.
+  double turn_rad;    ///< @brief The turning radius.
+  double turn_ang;    ///< @brief The turning angle.
+
+  /** @brief Gives the values of the given limits, computed
+   **        only if they are not the last ones of this thread.
+   **
+   ** @param max_c  the maximum curvature,
+   ** @param max_d  the maximum curvature's derivative.
+   **
+   ** @return  the values of the given limits (which can change
+   **          at the next call in the same thread).
+   **/
+  static const FscValues& get(const double& max_c, const double& max_d) {
+    // the first limits (zero) are not correct: they are computed
+    static thread_local FscValues last = {0, 0, 0, 0, 0};
+    if ( (last.turn_rad == 0) || (last.max_curv != fabs(max_c))
+	 || (last.max_deriv != fabs(max_d)) ) {
+      last.max_curv = fabs(max_c);   last.max_deriv = fabs(max_d);
+      iSeeML::rob::FscPath::computeValues(last.max_curv, last.max_deriv,
+					  last.lim_defl, last.turn_rad,
+					  last.turn_ang);
+    } // end of if (new limits)
+    return last;
+  } // end of static const FscValues& get(const double&, ...)
+
+  /** @brief Gives a FSC path of the given limits, which can then
+   **        be connected (see @ref PathConnector).
+   **
+   ** @param start  the starting configuration of the path,
+   ** @param max_c  the maximum curvature,
+   ** @param max_d  the maximum curvature's derivative.
+   **
+   ** @return  a (zero length) FSC path of the given limits.
+   **/
+  static iSeeML::rob::FscPath path(const iSeeML::rob::OrPtConfig& start,
+				   const double& max_c,
+				   const double& max_d) {
+    const FscValues& val = get(max_c, max_d);
+    return iSeeML::rob::FscPath(start, iSeeML::rob::FscPath::lsl,
+				val.max_curv, val.max_deriv,
+				val.lim_defl, val.turn_rad,
+				val.turn_ang, 0, 0, 0);
+  } // end of static iSeeML::rob::FscPath path(...)
+
+}; // end of struct FscValues
+
+#endif // QTCTRL_FSC_VALUES
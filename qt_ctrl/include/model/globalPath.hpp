@@ -0,0 +1,75 @@
+/**
+ ** @file  include/model/globalPath.hpp
+ **
+ ** @brief Path made of a FSC path between two line segments.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_GLOBAL_PATH
+#define QTCTRL_GLOBAL_PATH
+
+#include <iSeeML/rob/FscPath.hpp>
+
+
+/**
+ ** @brief GlobalPath is the path followed by the
+ **        @ref SmoothPathCtrl "smooth path controller": a line
+ **        segment to accelerate, a FSC path, and a line segment
+ **        to brake.
+ **
+ ** The three parts are stored by value: the path is only changed
+ ** (and its pieces allocated) when the FSC path changes,
+ ** and can then be read as often as needed.
+ **
+ ** @since 0.3.3
+ */
+class GlobalPath : public iSeeML::rob::CompoundPath {
+  iSeeML::rob::LinCurvPath first;  ///< @brief The first segment.
+  iSeeML::rob::FscPath middle;     ///< @brief The FSC path.
+  iSeeML::rob::LinCurvPath last;   ///< @brief The last segment.
+
+public:
+  /// @brief The default constructor gives an empty FSC path
+  ///        between two zero length segments.
+  GlobalPath() {}
+
+  /** @brief Changes the parts of the path.
+   **
+   ** @param path      the FSC path,
+   ** @param acc_dist  the length of the segment before it,
+   ** @param dec_dist  the length of the segment after it.
+   **/
+  void set(const iSeeML::rob::FscPath& path, const double& acc_dist,
+	   const double& dec_dist) {
+    first = iSeeML::rob::LinCurvPath
+      ( iSeeML::rob::CurvConfig( path.start()
+				 + iSeeML::rob::OrPtConfig(- acc_dist, 0, 0),
+				 0 ), 0, acc_dist );
+    middle = path;
+    last = iSeeML::rob::LinCurvPath
+      ( iSeeML::rob::CurvConfig(path.end(), 0), 0, dec_dist );
+  } // end of void set(const iSeeML::rob::FscPath&, ...)
+
+  /// @brief Gives the FSC path, between the segments.
+  /// @return  the FSC path of this path.
+  const iSeeML::rob::FscPath& fscPath() const { return middle; }
+
+  // Cf iSeeML::Object::clone()
+  iSeeML::Object& clone() const
+  { return *( (iSeeML::Object*)( new GlobalPath(*this) ) ); }
+
+  // Cf iSeeML::rob::CompoundPath::nbPieces()
+  int nbPieces() const { return middle.nbPieces() + 2; }
+
+protected:
+  // Cf iSeeML::rob::CompoundPath::_piece(const int)
+  iSeeML::rob::BasicPath& _piece(const int index) const {
+    const iSeeML::rob::BasicPath& piece = index <= 1 ? first
+      : index > middle.nbPieces() + 1 ? last : middle.piece(index - 1);
+    return const_cast<iSeeML::rob::BasicPath&>(piece);
+  } // end of iSeeML::rob::BasicPath& _piece(const int) const
+
+}; // end of class GlobalPath
+
+#endif // QTCTRL_GLOBAL_PATH
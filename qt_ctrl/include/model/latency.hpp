@@ -0,0 +1,154 @@
+/**
+ ** @file  include/model/latency.hpp
+ **
+ ** @brief Histograms of the control loop's timing.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_LATENCY
+#define QTCTRL_LATENCY
+
+#include <atomic>
+#include <string>
+
+
+/**
+ ** @brief LatencyHistogram counts durations (in microseconds)
+ **        in logarithmic buckets, as HDR histograms do.
+ **
+ ** Durations below 64 µs have their own bucket; above, each power
+ ** of two is split in 32 buckets: the relative precision is 3 %,
+ ** up to about an hour, with less than a thousand buckets.
+ ** A duration is @ref record "recorded" by a few relaxed atomic
+ ** operations, without lock nor allocation: the loop's thread
+ ** records while another one (e.g. the GUI's) reads.
+ **
+ ** @warning A reading concurrent with a recording can miss it
+ **          (or miss only a part of it): the read values are exact
+ **          only when the recordings are stopped.
+ **
+ ** @since 0.3.3
+ */
+class LatencyHistogram {
+public:
+  /// @brief The number of buckets: one by duration below 64 µs,
+  ///        then 32 by power of two (up to 2<SUP>32</SUP> µs, about
+  ///        72 minutes: longer durations are in the last bucket).
+  enum { nbLinear = 64, nbSubBuckets = 32,
+	 nbBuckets = nbLinear + 26 * nbSubBuckets };
+
+private:
+  /// @brief The number of durations of each bucket.
+  std::atomic<unsigned long> counts[nbBuckets];
+  /// @brief The number of recorded durations.
+  std::atomic<unsigned long> nb_values;
+  /// @brief The longest recorded duration.
+  std::atomic<long> max_value;
+
+  /** @brief Gives the index of the bucket of a duration.
+   ** @param value  the duration (in µs).
+   ** @return  the index of its bucket.
+   **/
+  static int index(const long value) {
+    if (value < nbLinear)
+      return value < 0 ? 0 : value;
+    int exp = 1;  // (value >> exp) is in [nbSubBuckets, nbLinear[
+    while ( (value >> exp) >= nbLinear )
+      exp++;
+    const int id = nbLinear + (exp - 1) * nbSubBuckets
+      + (value >> exp) - nbSubBuckets;
+    return id < nbBuckets ? id : nbBuckets - 1;
+  } // end of static int index(const long)
+
+  /** @brief Gives the highest duration of a bucket.
+   ** @param id  the index of the bucket.
+   ** @return  the highest duration (in µs) of this bucket.
+   **/
+  static long highest(const int id) {
+    if (id < nbLinear)
+      return id;
+    const int exp = (id - nbLinear) / nbSubBuckets + 1;
+    return ( (long)( (id - nbLinear) % nbSubBuckets + nbSubBuckets
+		     + 1 ) << exp ) - 1;
+  } // end of static long highest(const int)
+
+public:
+  /// @brief The default constructor gives an empty histogram.
+  LatencyHistogram() { clear(); }
+
+  /// @brief Removes all the recorded durations.
+  void clear() {
+    for(int id = 0; id < nbBuckets; id++)
+      counts[id].store(0, std::memory_order_relaxed);
+    nb_values.store(0, std::memory_order_relaxed);
+    max_value.store(0, std::memory_order_relaxed);
+  } // end of void clear()
+
+  /** @brief Records a duration.
+   ** @param value  the duration (in µs).
+   **/
+  void record(const long value) {
+    counts[ index(value) ].fetch_add(1, std::memory_order_relaxed);
+    nb_values.fetch_add(1, std::memory_order_relaxed);
+    long max = max_value.load(std::memory_order_relaxed);
+    while ( (value > max) && !max_value.compare_exchange_weak
+	    (max, value, std::memory_order_relaxed) ) ;
+  } // end of void record(const long)
+
+  /// @brief Gives the number of recorded durations.
+  /// @return  the number of recorded durations.
+  unsigned long count() const
+  { return nb_values.load(std::memory_order_relaxed); }
+
+  /// @brief Gives the longest recorded duration.
+  /// @return  the longest recorded duration (in µs).
+  long maximum() const
+  { return max_value.load(std::memory_order_relaxed); }
+
+  /** @brief Gives a percentile of the recorded durations.
+   **
+   ** @param percent  the percentage of durations (between 0 and 100)
+   **                 which should be below the result.
+   **
+   ** @return  the highest duration (in µs) of the bucket where this
+   **          percentage is reached (zero if there is no duration),
+   **          never more than the @ref maximum.
+   **/
+  long percentile(const double& percent) const;
+
+}; // end of class LatencyHistogram
+
+
+/**
+ ** @brief LoopTiming gathers the histograms of a control loop,
+ **        recorded at each cycle.
+ **
+ ** @since 0.3.3
+ */
+struct LoopTiming {
+  /// @brief The age of the odometry data when velocities are chosen.
+  LatencyHistogram odom_age;
+  /// @brief The duration of the velocities' choice.
+  LatencyHistogram compute;
+  /// @brief The difference between the duration of a cycle
+  ///        (from its start to the next one's) and the time step
+  ///        (not recorded when the loop is event-driven).
+  LatencyHistogram jitter;
+  /// @brief The number of cycles which missed their deadline.
+  std::atomic<unsigned long> overruns;
+  /// @brief The number of event-driven cycles started by the watchdog
+  ///        (no odometry arrived in time).
+  std::atomic<unsigned long> timeouts;
+
+  /// @brief The default constructor gives empty histograms.
+  LoopTiming() : overruns(0), timeouts(0) {}
+
+  /// @brief Gives a summary of the histograms (their median,
+  ///        99th percentile and maximum, in milliseconds).
+  /// @return  a summary of the histograms, one line by histogram.
+  std::string summary() const;
+
+}; // end of struct LoopTiming
+
+#endif // QTCTRL_LATENCY
@@ -0,0 +1,112 @@
+/**
+ ** @file  include/model/logRing.hpp
+ **
+ ** @brief Lock-free ring of log messages.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_LOG_RING
+#define QTCTRL_LOG_RING
+
+#include <string.h>                 // to get strncpy() declaration
+#include <streambuf>
+#include <model/ringBuffer.hpp>
+
+
+/**
+ ** @brief LogEntry is a log message, with a fixed size of text
+ **        (to be copied into a @ref LogRing "log ring" without
+ **        allocation).
+ **
+ ** @since 0.3.3
+ */
+struct LogEntry {
+  /// @brief The size of the text (with its final null character).
+  enum { textSize = 240 };
+
+  int    level;            ///< @brief The severity level.
+  double date;             ///< @brief The date of the message.
+  char   text[textSize];   ///< @brief The (null terminated) text.
+}; // end of struct LogEntry
+
+
+/**
+ ** @brief LogRing passes log messages from a thread (e.g. the control
+ **        loop) to another one (e.g. the GUI's), without lock nor
+ **        allocation.
+ **
+ ** It is a @ref RingBuffer "ring" of a fixed number of entries,
+ ** each one with a fixed size of text: longer messages are
+ ** truncated when they are @ref push "pushed".
+ **
+ ** @warning There should be only one writer thread and one reader
+ **          thread.
+ **
+ ** @since 0.3.3
+ */
+class LogRing : public RingBuffer<LogEntry, 256> {
+public:
+  /// @brief An entry of the ring.
+  typedef LogEntry Entry;
+
+  /// @brief The size of the entries' text (with its final null
+  ///        character).
+  enum { textSize = Entry::textSize };
+
+  /** @brief Pushes a message (by the writer thread only).
+   **
+   ** @param level  the severity level of the message,
+   ** @param date   the date of the message,
+   ** @param text   the (null terminated) text of the message,
+   **               truncated if it is too long.
+   **
+   ** @return  whether the message was pushed (false if the ring
+   **          is full: the message is then dropped).
+   **/
+  bool push(const int level, const double& date, const char* text) {
+    Entry entry;
+    entry.level = level;  entry.date = date;
+    strncpy(entry.text, text, textSize - 1);
+    entry.text[textSize - 1] = '\0';
+    return RingBuffer<LogEntry, 256>::push(entry);
+  } // end of bool push(const int, const double&, const char*)
+
+}; // end of class LogRing
+
+
+/**
+ ** @brief LogBuffer is a stream buffer writing into a fixed array
+ **        of characters (the text of a @ref LogRing "log entry"):
+ **        a std::ostream using it never allocates memory.
+ **
+ ** Characters which do not fit into the array are dropped.
+ **
+ ** @since 0.3.3
+ */
+class LogBuffer : public std::streambuf {
+  char text[LogRing::textSize];  ///< @brief The written characters.
+
+public:
+  /// @brief The default constructor gives an empty buffer.
+  LogBuffer() { clear(); }
+
+  /// @brief Removes all the written characters.
+  void clear() { setp(text, text + LogRing::textSize - 1); }
+
+  /// @brief Gives the written characters.
+  /// @return  the (null terminated) written characters.
+  const char* str() { *pptr() = '\0'; return text; }
+
+  /// @brief Tells whether no character was written.
+  /// @return  whether the buffer is empty.
+  bool empty() const { return pptr() == pbase(); }
+
+protected:
+  // Cf std::streambuf::overflow(int_type): the array is full
+  int_type overflow(int_type ch)
+  { return traits_type::not_eof(ch); }  // character dropped
+
+}; // end of class LogBuffer
+
+#endif // QTCTRL_LOG_RING
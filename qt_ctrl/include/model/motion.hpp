@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <string.h>  // To get memcpy definition
+#include <math.h>    // To get fabs definition
 
 
 /** @brief This class defines a motion model, with the motion 
@@ -43,6 +44,66 @@ class MotionModel {
   /// @brief The array of limits.
   double limits[nbLimits]; 
 
+  /// @brief These are the indexes of the arrays of limits 
+  ///        precomputed for each velocity.  @since 0.3.3
+  enum Velocities {
+    transl,  ///< Index of the translation velocity.
+    rot,     ///< Index of the  rotation   velocity.
+    nbVels,  ///< Number of velocities.
+  };
+
+  /// @brief The minimum velocities.  @since 0.3.3
+  double min_vel[nbVels];
+  /// @brief The maximum velocities.  @since 0.3.3
+  double max_vel[nbVels];
+  /// @brief The maximum accelerations.  @since 0.3.3
+  double max_acc[nbVels];
+  /// @brief The maximum decelerations (in absolute value).
+  /// @since 0.3.3
+  double max_dec[nbVels];
+
+protected:
+  /** @brief Gives the velocity reached applying, during the given 
+   **        time step, the acceleration (if the velocity has 
+   **        the acceleration's sign) or the deceleration (if not, 
+   **        the acceleration being applied for the remaining time 
+   **        once the velocity is null).
+   **
+   ** This is the branch free equivalent of the loops of the one 
+   ** robot methods: every value is computed, then the right ones 
+   ** are selected, which lets the compiler vectorize the callers.
+   **
+   ** @param vel        the initial velocity,
+   ** @param sgn        the sign of the acceleration (-1 or 1),
+   ** @param acc        the absolute value of the acceleration,
+   ** @param dec        the absolute value of the deceleration,
+   ** @param min_vel    the minimum velocity,
+   ** @param max_vel    the maximum velocity,
+   ** @param time_step  the duration of the accelerations.
+   ** @return  the velocity at the end of the time step.
+   ** @since 0.3.3
+   **/
+  static double limitedVelocity(const double vel, const double sgn,
+				const double acc, const double dec,
+				const double min_vel,
+				const double max_vel,
+				const double time_step) {
+    const double stop_time = -vel * sgn / dec, 
+      dec_step = (stop_time < time_step) ? stop_time : time_step,
+      dec_time = (vel * sgn >= 0) ? 0 : dec_step,
+      acc_time = time_step - dec_time, 
+      // null velocity reached (exactly) if changing of sign
+      dec_vel = (acc_time > 0) ? 0 : vel + sgn * dec * dec_time,
+      start_vel = (dec_time > 0) ? dec_vel : vel,
+      new_vel = start_vel + sgn * acc * acc_time,
+      // acceleration: is max/min velocity respected?
+      up_vel = (new_vel > max_vel) ? max_vel : new_vel,
+      down_vel = (new_vel < min_vel) ? min_vel : new_vel,
+      lim_vel = (sgn > 0) ? up_vel : down_vel;
+    
+    return (acc_time > 0) ? lim_vel : new_vel;
+  } // end of static double limitedVelocity(...)
+
 public:
   /** @brief Minimum constructor, supposing that minimum velocities 
    **        and accelerations is the opposite of the maxima.
@@ -113,6 +174,25 @@ public:
   ///        acceleration.  @see aMax.
   const double& maxRotAcc()    const { return limits[gmMax]; }
 
+  /** @brief Gives a copy of this motion model, with velocities 
+   **        and accelerations multiplied by the given factors.
+   **
+   ** This allows to get a model of the same robot with a different
+   ** battery level or payload, for example.
+   **
+   ** @param vel_fact  the factor of the velocity limits,
+   ** @param acc_fact  the factor of the acceleration limits.
+   ** @return  the scaled motion model.
+   ** @since 0.3.3
+   **/
+  MotionModel scaled(const double& vel_fact,
+		     const double& acc_fact) const {
+    return MotionModel(vel_fact * limits[vMin], vel_fact * limits[vMax],
+		       vel_fact * limits[omMax], acc_fact * limits[aMin],
+		       acc_fact * limits[aMax], acc_fact * limits[gmMin],
+		       acc_fact * limits[gmMax]);
+  } // end of MotionModel scaled(const double&, const double&) const
+
   /// @brief Descriptive method, giving the limit acceleration
   ///        which ensure to avoid reaching limit distance for
   ///        a given distance, velocity and leader velocity.
@@ -171,12 +251,59 @@ public:
 			  const double& rot_acc, 
 			  const double& time_step) const;
   
+  /** @brief Batch version of @ref applyAccelerationFactors(double&,
+   **        double&, const double&, const double&, const double&)
+   **        const "the one robot method", for arrays of robots.
+   **
+   ** The same limits are applied to each robot, without branches
+   ** (only selections), so that the loop can be vectorized.
+   **
+   ** @param trans_vel   the translation velocities, to update,
+   ** @param rot_vel     the  rotation   velocities, to update,
+   ** @param trans_fact  the translation factors,
+   ** @param rot_fact    the  rotation   factors,
+   ** @param nb          the number of robots (size of the arrays),
+   ** @param time_step   the duration of the accelerations.
+   ** @since 0.3.3
+   **/
+  void applyAccelerationFactors(double* trans_vel, double* rot_vel,
+				const double* trans_fact,
+				const double* rot_fact, const int nb,
+				const double& time_step) const;
+
+  /** @brief Batch version of @ref applyAccelerations(double&,
+   **        double&, const double&, const double&, const double&)
+   **        const "the one robot method", for arrays of robots.
+   **
+   ** The same limits are applied to each robot, without branches
+   ** (only selections), so that the loop can be vectorized.
+   **
+   ** @param trans_vel   the translation velocities, to update,
+   ** @param rot_vel     the  rotation   velocities, to update,
+   ** @param trans_acc   the translation accelerations,
+   ** @param rot_acc     the  rotation   accelerations,
+   ** @param nb          the number of robots (size of the arrays),
+   ** @param time_step   the duration of the accelerations.
+   ** @since 0.3.3
+   **/
+  void applyAccelerations(double* trans_vel, double* rot_vel,
+			  const double* trans_acc,
+			  const double* rot_acc, const int nb,
+			  const double& time_step) const;
+
   /// @brief Set the motion's limits.
   /// @param values  The motion's limits in an array of @ref nbLimits
   ///                doubles, in the order defined by @ref Limits.
-  /// @see limits.
-  void set(const double values[nbLimits]) 
-  { memcpy(limits, values, sizeof(double) * nbLimits); }
+  /// @see limits, min_vel, max_vel, max_acc, max_dec.
+  void set(const double values[nbLimits]) {
+    memcpy(limits, values, sizeof(double) * nbLimits);
+    // precomputes the limits of each velocity
+    min_vel[transl] = limits[vMin];   min_vel[rot] = - limits[omMax];
+    max_vel[transl] = limits[vMax];   max_vel[rot] = limits[omMax];
+    max_acc[transl] = limits[aMax];   max_acc[rot] = limits[gmMax];
+    max_dec[transl] = fabs(limits[aMin]);
+    max_dec[rot]    = fabs(limits[gmMin]);
+  } // end of void set(const double[nbLimits])
   
 }; // end of class MotionModel
 
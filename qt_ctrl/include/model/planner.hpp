@@ -0,0 +1,63 @@
+/**
+ ** @file  include/model/planner.hpp
+ **
+ ** @brief Parallel planning of many Dubins-like paths.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_PLANNER
+#define QTCTRL_PLANNER
+
+#include <iSeeML/rob/FscPath.hpp>
+#include <iSeeML/rob/DubinsPath.hpp>
+
+
+/**
+ ** @brief BatchPlanner gives the lengths of the shortest paths
+ **        connecting many pairs of configurations
+ **        (e.g. for reachability maps).
+ **
+ ** The pairs are planned in parallel threads, one by core.  Each
+ ** thread has its own @ref PathConnector "connector", and takes
+ ** the next block of pairs as soon as it has finished its previous
+ ** one: the load is balanced even if some paths are longer to plan.
+ **
+ ** @since 0.3.3
+ */
+class BatchPlanner {
+public:
+  /** @brief Plans FSC paths between pairs of configurations.
+   **
+   ** @param model   a FSC path giving the paths' parameters
+   **                 (maximum curvature and curvature's derivative),
+   ** @param starts  the starting configurations,
+   ** @param goals   the goal configurations,
+   ** @param nb      the number of pairs of configurations,
+   ** @param lengths the lengths of the paths (output),
+   ** @param types   the types of the paths (output, ignored if NULL).
+   **/
+  static void plan(const iSeeML::rob::FscPath& model,
+		   const iSeeML::rob::OrPtConfig* starts,
+		   const iSeeML::rob::OrPtConfig* goals, const int nb,
+		   double* lengths,
+		   iSeeML::rob::DubinsLikePath::Type* types = NULL);
+
+  /** @brief Plans Dubins paths between pairs of configurations.
+   **
+   ** @param model   a Dubins path giving the paths' maximum curvature,
+   ** @param starts  the starting configurations,
+   ** @param goals   the goal configurations,
+   ** @param nb      the number of pairs of configurations,
+   ** @param lengths the lengths of the paths (output),
+   ** @param types   the types of the paths (output, ignored if NULL).
+   **/
+  static void plan(const iSeeML::rob::DubinsPath& model,
+		   const iSeeML::rob::OrPtConfig* starts,
+		   const iSeeML::rob::OrPtConfig* goals, const int nb,
+		   double* lengths,
+		   iSeeML::rob::DubinsLikePath::Type* types = NULL);
+
+}; // end of class BatchPlanner
+
+#endif // QTCTRL_PLANNER
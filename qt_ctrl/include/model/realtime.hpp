@@ -0,0 +1,78 @@
+/**
+ ** @file  include/model/realtime.hpp
+ **
+ ** @brief Real-time scheduling of a periodic thread.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_REALTIME
+#define QTCTRL_REALTIME
+
+#include <string>
+#include <time.h>                   // to get timespec declaration
+
+
+/**
+ ** @brief RealTimeOptions are the options of the real-time mode
+ **        of a thread (see @ref setup).
+ **
+ ** @since 0.3.3
+ */
+struct RealTimeOptions {
+  bool enabled;   ///< @brief Whether the real-time mode is asked.
+  int  cpu;       ///< @brief The core of the thread (none if < 0).
+  int  priority;  ///< @brief The @c SCHED_FIFO priority (1 to 99).
+
+  /// @brief The default constructor gives the default options
+  ///        (real-time mode disabled, priority 80, no core).
+  RealTimeOptions() : enabled(false), cpu(-1), priority(80) {}
+
+  /** @brief Sets the calling thread in real-time mode.
+   **
+   ** This pins the thread to the @ref cpu "given core" (if any),
+   ** asks the @c SCHED_FIFO policy with the @ref priority
+   ** "given priority", locks the memory of the process (current
+   ** and future pages), and pre-faults a part of the thread's stack.
+   ** Each step can fail (e.g. without the needed privileges):
+   ** the following ones are still tried.
+   **
+   ** @return  a report of the steps, giving the failed ones.
+   **/
+  std::string setup() const;
+
+}; // end of struct RealTimeOptions
+
+
+/**
+ ** @brief DeadlineTimer wakes a thread up periodically, at absolute
+ **        dates of the monotonic clock: the delays of a cycle
+ **        (computation, late wake up) do not shift the next ones.
+ **
+ ** @since 0.3.3
+ */
+class DeadlineTimer {
+  long period;             ///< @brief The period, in nanoseconds.
+  struct timespec next;    ///< @brief The next deadline.
+
+public:
+  /** @brief The constructor sets the first deadline a period
+   **        after the current date.
+   **
+   ** @param prd  the period, in seconds.
+   **/
+  DeadlineTimer(const double& prd);
+
+  /** @brief Sleeps until the next deadline, and sets the following
+   **        one.
+   **
+   ** If the deadline is already missed, the timer does not sleep,
+   ** and the following deadline is a period after the current date.
+   **
+   ** @return  whether the deadline was met.
+   **/
+  bool sleep();
+
+}; // end of class DeadlineTimer
+
+#endif // QTCTRL_REALTIME
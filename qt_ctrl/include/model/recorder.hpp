@@ -0,0 +1,263 @@
+/**
+ ** @file  include/model/recorder.hpp
+ **
+ ** @brief Binary record and replay of a controller's inputs
+ **        and outputs.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_RECORDER
+#define QTCTRL_RECORDER
+
+#include <vector>
+#include <fstream>
+#include <atomic>
+#include <algorithm>                // to get std::copy() declaration
+#include <QThread>
+#include <model/state.hpp>
+#include <model/ringBuffer.hpp>
+#include <ctrl/reach.hpp>
+
+
+/**
+ ** @brief MotionRecorder writes in a compact binary file the states
+ **        received by a controller (from odometry), the goals given
+ **        to it and the commands it chose, in their order, to
+ **        @ref MotionReplay "replay" them later.
+ **
+ ** The file begins with a header (eight magic characters, then
+ ** the time step).  Each record is a kind character followed
+ ** by doubles: @ref stateRecord "a state" and @ref goalRecord
+ ** "a goal" have their date, position, orientation and velocities
+ ** (six values), @ref commandRecord "a command" has the duration
+ ** of its cycle and the chosen velocities (three values).
+ ** The doubles are written as they are in memory (byte order
+ ** of the machine).
+ **
+ ** Recording does not write: the records are pushed in a
+ ** @ref RingBuffer "ring", without lock nor allocation, and
+ ** written by the recorder's own thread (a @ref refs_qt_thread,
+ ** started by @ref open and stopped by @ref close).  If this thread
+ ** is late (e.g. the disk is slow), the records which do not fit
+ ** in the ring are @ref dropped "dropped".
+ **
+ ** @warning The records should be given by a single thread.
+ **
+ ** @since 0.3.3
+ */
+class MotionRecorder : public QThread {
+public:
+  /// @brief The kinds of records.
+  enum Kind {
+    stateRecord   = 'S',  ///< A state received by the controller.
+    commandRecord = 'C',  ///< A command chosen by the controller.
+    goalRecord    = 'G',  ///< A goal given to a reaching controller.
+  };
+
+  /// @brief A record, with its kind and its values.
+  struct Record {
+    char   kind;        ///< @brief The kind of the record.
+    double values[6];   ///< @brief Its values (three or six).
+  };
+
+  /// @brief The magic characters beginning a record file.
+  static const char magic[8];
+
+  /// @brief Gives the number of values of a kind of records.
+  /// @param kind  the kind of records.
+  /// @return  the number of values, zero for an unknown kind.
+  static int nbValues(const char kind) {
+    return kind == commandRecord ? 3
+      : (kind == stateRecord) || (kind == goalRecord) ? 6 : 0;
+  }
+
+private:
+  /// @brief The records waiting to be written (more than a second
+  ///        of a 1 kHz control loop).
+  RingBuffer<Record, 4096> records;
+  /// @brief Whether the writing thread should stop.
+  std::atomic<bool> stopping;
+  bool open_file;               ///< @brief Whether a file is open.
+  std::ofstream output;         ///< @brief The record file.
+  char buffer[1 << 16];         ///< @brief The buffer of the file.
+
+  /// @brief Pushes a record, to be written.
+  /// @param kind    the kind of the record,
+  /// @param values  its values.
+  void push(const char kind, const double values[]) {
+    Record record;
+    record.kind = kind;
+    std::copy(values, values + nbValues(kind), record.values);
+    records.push(record);
+  } // end of void push(const char, const double[])
+
+  /// @brief Pushes a state's record, to be written.
+  /// @param kind   the kind of the record,
+  /// @param state  the state.
+  void push(const char kind, const State& state) {
+    const iSeeML::rob::OrPtConfig& q = state.configuration();
+    const double values[] =
+      { state.date(), q.position().xCoord(), q.position().yCoord(),
+	q.orientation(), state.translationVelocity(),
+	state.rotationVelocity() };
+    push(kind, values);
+  } // end of void push(const char, const State&)
+
+protected:
+  /// @brief Main loop of the thread: writes the pushed records
+  ///        until the file is closed.
+  void run();
+
+public:
+  /// @brief The default constructor does not open any file.
+  MotionRecorder() : stopping(false), open_file(false) {}
+
+  /// @brief The destructor closes the file (if open).
+  virtual ~MotionRecorder() { close(); }
+
+  /** @brief Opens a record file, writes its header, and starts
+   **        the writing thread.
+   **
+   ** @param file_name  the name of the file (overwritten),
+   ** @param time_step  the time step of the recorded controller.
+   **
+   ** @return  whether the file could be opened.
+   **/
+  bool open(const char* file_name, const double& time_step);
+
+  /// @brief Tells whether a record file is open.
+  /// @return  whether a record file is open.
+  bool isOpen() const { return open_file; }
+
+  /// @brief Records a state received by the controller.
+  /// @param state  the received state.
+  void state(const State& state) { push(stateRecord, state); }
+
+  /** @brief Records a goal given to a reaching controller.
+   **
+   ** @param goal  the goal, in the robot's frame of the next state
+   **              (as given to ReachingCtrl::changeGoal, or to the
+   **              constructor before the first state).
+   **/
+  void goal(const State& goal) { push(goalRecord, goal); }
+
+  /** @brief Records a command chosen by the controller.
+   **
+   ** @param cycle_time  the duration of the controller's cycle,
+   ** @param trans_vel   the chosen translation velocity,
+   ** @param rot_vel     the chosen rotation velocity.
+   **/
+  void command(const double& cycle_time, const double& trans_vel,
+	       const double& rot_vel) {
+    const double values[] = { cycle_time, trans_vel, rot_vel };
+    push(commandRecord, values);
+  } // end of void command(const double&, ...)
+
+  /// @brief Gives the number of records dropped since the beginning.
+  /// @return  the number of dropped records.
+  unsigned long dropped() const { return records.dropped(); }
+
+  /// @brief Stops the writing thread, once the pushed records are
+  ///        written, and closes the file.
+  void close();
+
+}; // end of class MotionRecorder
+
+
+/**
+ ** @brief ReplayResult compares the commands of a replayed controller
+ **        with the recorded ones.
+ **
+ ** @since 0.3.3
+ */
+struct ReplayResult {
+  unsigned long nb_commands;  ///< @brief The number of commands.
+  double max_trans_diff;      ///< @brief The maximum translation
+                              ///         velocity's difference.
+  double max_rot_diff;        ///< @brief The maximum rotation
+                              ///         velocity's difference.
+  double mean_trans_diff;     ///< @brief The mean translation
+                              ///         velocity's difference.
+  double mean_rot_diff;       ///< @brief The mean rotation
+                              ///         velocity's difference.
+  /// @brief The index of the first command differing more than
+  ///        the tolerance, or -1 if none does.
+  long first_diff;
+
+  /// @brief The default constructor gives no command.
+  ReplayResult() : nb_commands(0), max_trans_diff(0), max_rot_diff(0),
+		   mean_trans_diff(0), mean_rot_diff(0), first_diff(-1) {}
+
+}; // end of struct ReplayResult
+
+
+/**
+ ** @brief MotionReplay reads a file written by a @ref MotionRecorder
+ **        "recorder", and gives its states and goals to a controller
+ **        (as fast as possible), comparing the chosen commands with
+ **        the recorded ones.
+ **
+ ** The controller is called the same way the @ref ROSnode
+ ** "ROS node" did: a new state before choosing the velocities
+ ** when one was received, the recorded duration of each cycle,
+ ** and the recorded goals through ReachingCtrl::changeGoal (the
+ ** controller's own goal is thus replaced).
+ ** Comparing a changed controller with a recording of the previous
+ ** one gives a regression check without any simulation.
+ **
+ ** @warning The @ref SmoothPathCtrl "smooth path controller" takes
+ **          the paths of its replanning thread when they are ready:
+ **          its commands only depend on its inputs with a
+ **          @ref SmoothPathCtrl::setSynchronousReplanning
+ **          "synchronous replanning".  Otherwise, the replayed
+ **          commands can differ from the first replanned path on.
+ **
+ ** @since 0.3.3
+ */
+class MotionReplay {
+  /// @brief A record, with its kind and its values.
+  typedef MotionRecorder::Record Record;
+
+  std::vector<Record> records;  ///< @brief The read records.
+  double time_step;             ///< @brief The recorded time step.
+
+public:
+  /// @brief The default constructor gives no record.
+  MotionReplay() : time_step(0) {}
+
+  /** @brief Reads a record file.
+   **
+   ** @param file_name  the name of the file.
+   **
+   ** @return  whether the file could be read (an unfinished last
+   **          record is ignored).
+   **/
+  bool load(const char* file_name);
+
+  /// @brief Gives the time step of the recorded controller.
+  /// @return  the recorded time step.
+  const double& timeStep() const { return time_step; }
+
+  /** @brief Gives the recorded states.
+   **
+   ** @param states  the recorded states (output).
+   **/
+  void states(std::vector<State>& states) const;
+
+  /** @brief Replays the recording with a controller.
+   **
+   ** @param ctrl       the controller (it should be new: its
+   **                   internal state matters),
+   ** @param tolerance  the maximum difference of velocities which is
+   **                   not a @ref ReplayResult::first_diff
+   **                   "difference".
+   **
+   ** @return  the comparison of the commands.
+   **/
+  ReplayResult run(Controller& ctrl, const double& tolerance = 1E-9)
+    const;
+
+}; // end of class MotionReplay
+
+#endif // QTCTRL_RECORDER
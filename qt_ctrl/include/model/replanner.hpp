@@ -0,0 +1,116 @@
+/**
+ ** @file  include/model/replanner.hpp
+ **
+ ** @brief Background replanning of FSC paths.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_REPLANNER
+#define QTCTRL_REPLANNER
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <iSeeML/rob/FscPath.hpp>
+#include <model/connector.hpp>
+
+
+/**
+ ** @brief Replanner plans FSC paths in its own thread, so that
+ **        a controller does not wait for them in its control cycle.
+ **
+ ** A controller @ref request "requests" a path, and then
+ ** @ref take "takes" it when it is ready (waiting for it during
+ ** a given time budget at most), keeping its previous path
+ ** meanwhile.  A path is only given if it is shorter than the
+ ** length given with its request: longer paths are dropped by the
+ ** planning thread.  A new request replaces the previous one
+ ** (whose path is dropped if it was not taken), and @ref cancel
+ ** drops both the request and its path (e.g. when the goal changes).
+ **
+ ** This is a @ref refs_qt_thread, started by the constructor
+ ** and stopped by the destructor.
+ **
+ ** @since 0.3.3
+ */
+class Replanner : public QThread {
+  /// @brief The connector of the planning thread.
+  PathConnector<iSeeML::rob::FscPath> connector;
+  /// @brief The mutex protecting the following data.
+  QMutex mutex;
+  /// @brief The condition signaling a new request (or the end).
+  QWaitCondition requested;
+  /// @brief The condition signaling the end of a planning.
+  QWaitCondition planned;
+  /// @brief The requested path (giving the parameters),
+  ///        then the planned one.
+  iSeeML::rob::FscPath path;
+  iSeeML::rob::OrPtConfig start_conf;  ///< @brief The requested start.
+  iSeeML::rob::OrPtConfig goal_conf;   ///< @brief The requested goal.
+  /// @brief The length that the path should not reach.
+  double max_length;
+  /// @brief The value given with the request, given back
+  ///        with its path.
+  double tag;
+  /// @brief The number of requests (and of cancellations),
+  ///        which identifies the last one.
+  unsigned long request_nb;
+  bool pending;   ///< @brief Whether a request waits for the thread.
+  bool planning;  ///< @brief Whether the thread plans a path.
+  bool ready;     ///< @brief Whether a path can be taken.
+  bool stopping;  ///< @brief Whether the thread should stop.
+
+protected:
+  /// @brief Main loop of the thread: plans the requested paths
+  ///        until the destructor is called.
+  void run();
+
+public:
+  /// @brief The constructor starts the planning thread.
+  Replanner() : max_length(0), tag(0), request_nb(0), pending(false),
+		planning(false), ready(false), stopping(false)
+  { start(); }
+
+  /// @brief The destructor stops the planning thread.
+  virtual ~Replanner();
+
+  /** @brief Requests a path, replacing any previous request.
+   **
+   ** @param model   a FSC path giving the path's parameters,
+   ** @param strt    the starting configuration,
+   ** @param gl      the goal configuration,
+   ** @param max_l   the length that the path should not reach
+   **                 to be given,
+   ** @param tg      a value given back with the path (e.g. the
+   **                 distance covered when it was requested).
+   **/
+  void request(const iSeeML::rob::FscPath& model,
+	       const iSeeML::rob::OrPtConfig& strt,
+	       const iSeeML::rob::OrPtConfig& gl, const double& max_l,
+	       const double& tg);
+
+  /// @brief The budget of @ref take which waits until the end
+  ///        of the planning (synchronous replanning, e.g. to
+  ///        @ref MotionReplay "replay" a recording).
+  static const unsigned long unlimited = ~0UL;
+
+  /** @brief Takes the path of the last request, if it is ready.
+   **
+   ** @param pth     the path, changed only if one is taken,
+   ** @param tg      the value given with its request (idem),
+   ** @param budget  the time (in milliseconds) to wait at most
+   **                 for a path which is being planned, or
+   **                 @ref unlimited to wait for its end.
+   **
+   ** @return  whether a path was taken.
+   **/
+  bool take(iSeeML::rob::FscPath& pth, double& tg,
+	    const unsigned long budget);
+
+  /// @brief Drops the last request and its path.
+  void cancel();
+
+}; // end of class Replanner
+
+#endif // QTCTRL_REPLANNER
@@ -0,0 +1,86 @@
+/**
+ ** @file  include/model/ringBuffer.hpp
+ **
+ ** @brief Lock-free ring passing values between two threads.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_RING_BUFFER
+#define QTCTRL_RING_BUFFER
+
+#include <atomic>
+
+
+/**
+ ** @brief RingBuffer passes values from a thread to another one,
+ **        in their order, without lock nor allocation.
+ **
+ ** The writer @ref push "pushes" its values, and the reader
+ ** @ref pop "pops" them when it wants: if the ring is full, new
+ ** values are dropped (and @ref dropped "counted"), the writer
+ ** never waits.
+ **
+ ** @warning There should be only one writer thread and one reader
+ **          thread.
+ **
+ ** @param T  the class of the values (copiable),
+ ** @param N  the number of entries.
+ **
+ ** @since 0.3.3
+ */
+template<class T, int N>
+class RingBuffer {
+  T entries[N];                   ///< @brief The entries.
+  /// @brief The number of pushed entries (written by the writer).
+  std::atomic<unsigned long> head;
+  /// @brief The number of popped entries (written by the reader).
+  std::atomic<unsigned long> tail;
+  /// @brief The number of dropped entries.
+  std::atomic<unsigned long> nb_dropped;
+
+public:
+  /// @brief The default constructor gives an empty ring.
+  RingBuffer() : head(0), tail(0), nb_dropped(0) {}
+
+  /** @brief Pushes a value (by the writer thread only).
+   **
+   ** @param value  the value.
+   **
+   ** @return  whether the value was pushed (false if the ring
+   **          is full: the value is then dropped).
+   **/
+  bool push(const T& value) {
+    const unsigned long id = head.load(std::memory_order_relaxed);
+    if ( id - tail.load(std::memory_order_acquire) >= N ) {
+      nb_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } // end of if (full ring)
+    entries[id % N] = value;
+    head.store(id + 1, std::memory_order_release);  // then readable
+    return true;
+  } // end of bool push(const T&)
+
+  /** @brief Pops the oldest value (by the reader thread only).
+   **
+   ** @param value  the oldest value, changed only if there is one.
+   **
+   ** @return  whether there was a value.
+   **/
+  bool pop(T& value) {
+    const unsigned long id = tail.load(std::memory_order_relaxed);
+    if ( id == head.load(std::memory_order_acquire) )
+      return false;
+    value = entries[id % N];
+    tail.store(id + 1, std::memory_order_release);  // then writable
+    return true;
+  } // end of bool pop(T&)
+
+  /// @brief Gives the number of values dropped since the beginning.
+  /// @return  the number of dropped values.
+  unsigned long dropped() const
+  { return nb_dropped.load(std::memory_order_relaxed); }
+
+}; // end of class RingBuffer
+
+#endif // QTCTRL_RING_BUFFER
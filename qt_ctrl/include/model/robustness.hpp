@@ -0,0 +1,113 @@
+/**
+ ** @file  include/model/robustness.hpp
+ **
+ ** @brief Evaluation of a controller over a family of motion models.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_ROBUSTNESS
+#define QTCTRL_ROBUSTNESS
+
+#include <vector>
+#include <functional>
+#include <model/simulator.hpp>
+
+
+/**
+ ** @brief RobustnessEval simulates the same controller (i.e. the same
+ **        gains) with several motion models, in parallel, and gives
+ **        the worst or the expected cost.
+ **
+ ** The cost of a motion model is the @ref Simulator::distance
+ ** "distance" between the simulated trajectory and a reference one.
+ ** Each simulation uses its own controller, made for its model.
+ **
+ ** @since 0.3.3
+ */
+class RobustnessEval {
+public:
+  /// @brief Function making a new controller for a motion model
+  ///        (which will be deleted after the simulation).
+  typedef std::function<Controller*(const MotionModel&)> CtrlMaker;
+
+  /// @brief The ways to combine the costs of the motion models.
+  enum Criterion {
+    worstCost,     ///< The maximum of the costs.
+    expectedCost,  ///< The mean of the costs.
+  };
+
+private:
+  CtrlMaker make_ctrl;              ///< Makes the controllers.
+  std::vector<State> reference;     ///< The reference trajectory.
+  State initial;                    ///< The initial state.
+  double duration;                  ///< The simulations' duration.
+  int nb_substeps;                  ///< The Euler substeps, if any.
+
+public:
+  /** @brief The constructor needs the controllers' maker and
+   **        the simulation parameters.
+   **
+   ** @param maker     the function making the controllers,
+   ** @param ref       the reference trajectory,
+   ** @param init      the initial state of the robot,
+   ** @param dur       the duration of each simulation,
+   ** @param substeps  the number of Euler integration substeps
+   **                   (zero for the precise integration).
+   **
+   ** @see Simulator::Simulator, Simulator::run.
+   **/
+  RobustnessEval(const CtrlMaker& maker, const std::vector<State>& ref,
+		 const State& init, const double& dur,
+		 const int substeps = 0)
+    : make_ctrl(maker), reference(ref), initial(init), duration(dur),
+      nb_substeps(substeps) {}
+
+  /** @brief Gives the cost of each motion model, simulations being
+   **        run in parallel threads.
+   **
+   ** @param models  the motion models,
+   ** @param costs   the cost of each motion model (output),
+   **                 infinite if no controller could be made.
+   **/
+  void evaluate(const std::vector<MotionModel>& models,
+		std::vector<double>& costs) const;
+
+  /** @brief Gives the cost of a family of motion models.
+   **
+   ** @param models     the motion models,
+   ** @param criterion  the way to combine the models' costs.
+   **
+   ** @return  the worst or the expected cost.
+   **/
+  double cost(const std::vector<MotionModel>& models,
+	      const Criterion& criterion = worstCost) const;
+
+  /** @brief Gives the cost of one motion model (in this thread).
+   **
+   ** @param model  the motion model.
+   **
+   ** @return  the cost of the motion model.
+   **/
+  double cost(const MotionModel& model) const;
+
+  /** @brief Gives a family of motion models around a nominal one.
+   **
+   ** Velocity limits (e.g. for the battery level) and acceleration
+   ** limits (e.g. for the payload) are multiplied by one minus
+   ** the ratio, one, and one plus the ratio: this gives nine models,
+   ** the first being the nominal one.
+   **
+   ** @param nominal  the nominal motion model,
+   ** @param ratio    the ratio of the perturbations.
+   **
+   ** @return  the perturbed motion models.
+   **
+   ** @see MotionModel::scaled
+   **/
+  static std::vector<MotionModel>
+  perturbedModels(const MotionModel& nominal, const double& ratio = .2);
+
+}; // end of class RobustnessEval
+
+#endif // QTCTRL_ROBUSTNESS
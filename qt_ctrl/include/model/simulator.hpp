@@ -0,0 +1,277 @@
+/**
+ ** @file  include/model/simulator.hpp
+ **
+ ** @brief Headless simulator of the robot's motion.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_SIMULATOR
+#define QTCTRL_SIMULATOR
+
+#include <vector>
+#include <sstream>
+#include <math.h>                   // to get ceil() declaration
+#include <model/motion.hpp>
+#include <model/state.hpp>
+#include <ctrl/controller.hpp>
+
+
+/**
+ ** @brief SimulatorBase is the part of the @ref ModelSimulator
+ **        "simulators" which does not depend on the motion model.
+ **
+ ** @since 0.3.3
+ */
+class SimulatorBase {
+protected:
+  /// @brief The number of Euler integration substeps in a time
+  ///        step, or zero for the @ref exactMotion "precise"
+  ///        integration.
+  const int nb_substeps;
+
+  /// @brief The constructor only sets the number of substeps.
+  /// @param substeps  the number of Euler integration substeps
+  ///                   in a time step, or zero (or less) for 
+  ///                   the precise integration.
+  SimulatorBase(const int substeps)
+    : nb_substeps(substeps > 0 ? substeps : 0) {}
+
+  /** @brief Gives the configuration's change during a time step, 
+   **        in the frame of the initial configuration, 
+   **        for linearly changing velocities.
+   **
+   ** The change is computed in closed form if the rotation
+   ** velocity is constant (the robot then follows a circular arc,
+   ** or a line segment).  Otherwise, it is approximated by a four
+   ** nodes Gauss-Legendre quadrature, exact for polynomials of
+   ** degree seven: the integrand is the product of a linear
+   ** velocity and of the exponential of a quadratic phase, whose
+   ** variation during a time step is small.
+   **
+   ** @warning  The velocities should be linear during the step:
+   **           @ref integrate splits the steps where they are not
+   **           (see its @c trans_stop and @c rot_stop).
+   **
+   ** @param init_trans  the initial translation velocity,
+   ** @param init_rot    the initial  rotation   velocity,
+   ** @param trans_vel   the final translation velocity,
+   ** @param rot_vel     the final  rotation   velocity,
+   ** @param time_step   the duration of the step,
+   ** @param dx          the first  coordinate's change (output),
+   ** @param dy          the second coordinate's change (output).
+   ** @since 0.3.3
+   **/
+  static void exactMotion(const double& init_trans,
+			  const double& init_rot,
+			  const double& trans_vel, const double& rot_vel,
+			  const double& time_step, double& dx, double& dy);
+
+  /** @brief Gives the state of the robot one time step later, 
+   **        knowing its velocities at the end of the step.
+   **
+   ** The velocities are supposed to change linearly during 
+   ** the step.  The configuration is integrated @ref exactMotion
+   ** "precisely", or with an Euler scheme if substeps are defined.
+   **
+   ** @param state      the current state of the robot,
+   ** @param trans_vel  the final translation velocity,
+   ** @param rot_vel    the final  rotation   velocity,
+   ** @param time_step  the duration of the step.
+   **
+   ** @return  the state of the robot at the end of the step.
+   **/
+  State integrate(const State& state, const double& trans_vel,
+		  const double& rot_vel, const double& time_step) const;
+
+  /** @brief Gives the state of the robot one time step later,
+   **        its velocities changing of sign during the step.
+   **
+   ** A velocity changing of sign first decreases with
+   ** the deceleration, then increases with the acceleration:
+   ** if they differ (as -0.6 and 0.5 m/s² for the translation),
+   ** the velocity is only linear on each side of its null value.
+   ** The step is thus split at these dates, and each part
+   ** is @ref integrate(const State&, const double&, const double&,
+   ** const double&) const "integrated" with linear velocities.
+   **
+   ** @param state       the current state of the robot,
+   ** @param trans_vel   the final translation velocity,
+   ** @param rot_vel     the final  rotation   velocity,
+   ** @param time_step   the duration of the step,
+   ** @param trans_stop  the date (from the step's start) of the null
+   **                    translation velocity, or the time step if
+   **                    it keeps its sign,
+   ** @param rot_stop    idem for the rotation velocity.
+   **
+   ** @return  the state of the robot at the end of the step.
+   ** @since 0.3.3
+   **/
+  State integrate(const State& state, const double& trans_vel,
+		  const double& rot_vel, const double& time_step,
+		  const double& trans_stop, const double& rot_stop) const;
+
+  /** @brief Gives the date when a velocity is null, if it changes
+   **        of sign during a step.
+   **
+   ** @param init_vel   the initial velocity,
+   ** @param asked_vel  the commanded velocity,
+   ** @param final_vel  the final velocity (reached with the limits),
+   ** @param max_dec    the maximum deceleration (absolute value),
+   ** @param time_step  the duration of the step.
+   **
+   ** @return  the date (from the step's start) of the null velocity,
+   **          or the time step if the velocity keeps its sign.
+   ** @since 0.3.3
+   **/
+  static double stopDate(const double& init_vel,
+			 const double& asked_vel,
+			 const double& final_vel, const double& max_dec,
+			 const double& time_step) {
+    // applied deceleration: the asked one, bounded by the maximum
+    const double asked = fabs(asked_vel - init_vel) / time_step,
+      dec = asked < max_dec ? asked : max_dec;
+    if ( (init_vel * final_vel >= 0) || (dec <= 0) )
+      return time_step;
+    return fabs(init_vel) / dec < time_step ?
+      fabs(init_vel) / dec : time_step;
+  } // end of static double stopDate(const double&, ...)
+
+public:
+  /** @brief Gives the distance between two trajectories.
+   **
+   ** It is the sum of the distances between their positions
+   ** of same index, missing positions being at the origin,
+   ** as in <tt>PID/PID.py</tt>.
+   ** Both trajectories should thus have the same time step.
+   **
+   ** @param traject1  the first trajectory,
+   ** @param traject2  the second trajectory.
+   **
+   ** @return  the distance between the trajectories.
+   **/
+  static double distance(const std::vector<State>& traject1,
+			 const std::vector<State>& traject2);
+
+  /** @brief Reads a trajectory from a file, in the format of
+   **        the @ref DataWidget "output files".
+   **
+   ** @param file_name  the name of the file,
+   ** @param traject    the trajectory read (output).
+   **
+   ** @return  whether the file could be opened.
+   **/
+  static bool readTrajectory(const char* file_name,
+			     std::vector<State>& traject);
+
+}; // end of class SimulatorBase
+
+
+/**
+ ** @brief ModelSimulator replaces ROS and the robot to evaluate
+ **        a controller without any display.
+ **
+ ** It calls the @ref Controller "controller" the same way
+ ** the @ref ROSnode "ROS node" does, but as fast as possible.
+ ** The simulated robot reaches the commanded velocities as fast
+ ** as its motion model allows, and its configuration is integrated
+ ** @ref SimulatorBase::exactMotion "precisely" (closed form for
+ ** a constant rotation velocity, high-order quadrature otherwise),
+ ** or with an Euler scheme on substeps of the controller's time step.
+ ** A step is split when a velocity changes of sign.
+ **
+ ** @param Model  the class of the motion model: a @ref MotionModel,
+ **               or a @ref FixedMotionModel whose inlined methods
+ **               are then used.
+ **
+ ** @since 0.3.3
+ */
+template<class Model>
+class ModelSimulator : public SimulatorBase {
+  /// @brief The motion model of the simulated robot.
+  const Model& motion_model;
+
+public:
+  /** @brief The constructor needs the motion model of the robot.
+   **
+   ** @param model     the motion model of the simulated robot,
+   ** @param substeps  the number of Euler integration substeps
+   **                   in a time step, or zero for the precise
+   **                   integration (one evaluation per step).
+   **/
+  ModelSimulator(const Model& model, const int substeps = 0)
+    : SimulatorBase(substeps), motion_model(model) {}
+
+  /// @brief Gives the motion model of the simulated robot.
+  /// @return  the motion model of the simulated robot.
+  const Model& motionModel() const { return motion_model; }
+
+  /** @brief Gives the state of the robot one time step later.
+   **
+   ** @param state      the current state of the robot,
+   ** @param trans_vel  the commanded translation velocity,
+   ** @param rot_vel    the commanded  rotation   velocity,
+   ** @param time_step  the duration of the step.
+   **
+   ** @return  the state of the robot at the end of the step.
+   **/
+  State step(const State& state, const double& trans_vel,
+	     const double& rot_vel, const double& time_step) const {
+    const double init_trans = state.translationVelocity(),
+      init_rot = state.rotationVelocity();
+    double new_trans = init_trans, new_rot = init_rot;
+    // reaches the commands as fast as the motion model allows
+    motion_model.applyAccelerations
+      (new_trans, new_rot, (trans_vel - init_trans) / time_step,
+       (rot_vel - init_rot) / time_step, time_step);
+    // the velocities are linear until they change of sign
+    return integrate( state, new_trans, new_rot, time_step,
+		      stopDate(init_trans, trans_vel, new_trans,
+			       - motion_model.minTranslAcc(), time_step),
+		      stopDate(init_rot, rot_vel, new_rot,
+			       - motion_model.minRotAcc(), time_step) );
+  } // end of State step(const State&, ...) const
+
+  /** @brief Simulates the robot controlled by the given controller
+   **        during the given duration.
+   **
+   ** The controller receives the states (like odometry) and
+   ** chooses the velocities at each of its time steps.
+   ** Its logs are ignored.
+   **
+   ** @param ctrl      the controller,
+   ** @param initial   the initial state of the robot,
+   ** @param duration  the duration of the simulation,
+   ** @param traject   the trajectory followed by the robot,
+   **                   one state for each time step (output).
+   **/
+  void run(Controller& ctrl, const State& initial,
+	   const double& duration, std::vector<State>& traject) const {
+    const double& time_step = ctrl.timeStep();
+    // number of time steps, avoiding rounding errors
+    const int nb_steps = (int) ceil(duration / time_step - 1E-9);
+    State state(initial);
+    double trans_vel, rot_vel;
+    std::ostringstream log_str;  // logs are ignored
+    
+    traject.clear();
+    traject.reserve(nb_steps + 1);
+    ctrl.stopMotion();  // as in ROSnode::run()
+    ctrl.newState(state);
+    traject.push_back(state);
+    for(int id = 0; id < nb_steps; id++) {
+      log_str.str("");
+      ctrl.chooseVelocities(trans_vel, rot_vel, log_str);
+      state = step(state, trans_vel, rot_vel, time_step);
+      ctrl.newState(state);
+      traject.push_back(state);
+    } // end of for (each time step)
+  } // end of void run(Controller&, ...) const
+
+}; // end of class ModelSimulator
+
+/// @brief The simulator of a robot with any motion model.
+/// @since 0.3.3
+typedef ModelSimulator<MotionModel> Simulator;
+
+#endif // QTCTRL_SIMULATOR
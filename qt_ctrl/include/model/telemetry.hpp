@@ -0,0 +1,58 @@
+/**
+ ** @file  include/model/telemetry.hpp
+ **
+ ** @brief Lock-free passing of a controller's telemetry
+ **        to the GUI.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_TELEMETRY
+#define QTCTRL_TELEMETRY
+
+#include <model/state.hpp>
+#include <model/ringBuffer.hpp>
+
+
+/**
+ ** @brief Telemetry is an update of a controller, shown
+ **        by the @ref QtCtrlGUI "GUI": either a new state
+ **        of the robot, or new commands.
+ **
+ ** @since 0.3.3
+ */
+struct Telemetry {
+  /// @brief The kinds of updates.
+  enum Kind {
+    stateUpdate,     ///< A new state of the robot.
+    commandsUpdate,  ///< New commands of the controller.
+  };
+
+  Kind   kind;       ///< @brief The kind of update.
+  State  state;      ///< @brief The new state (if any).
+  double trans_vel;  ///< @brief The new translation velocity (if any).
+  double rot_vel;    ///< @brief The new rotation velocity (if any).
+
+  /// @brief The default constructor gives null commands.
+  Telemetry() : kind(commandsUpdate), state(), trans_vel(0),
+		rot_vel(0) {}
+
+  /// @brief The constructor of a state's update.
+  /// @param st  the new state.
+  Telemetry(const State& st) : kind(stateUpdate), state(st),
+			       trans_vel(0), rot_vel(0) {}
+
+  /// @brief The constructor of a commands' update.
+  /// @param trans  the new translation velocity,
+  /// @param rot    the new rotation velocity.
+  Telemetry(const double& trans, const double& rot)
+    : kind(commandsUpdate), state(), trans_vel(trans), rot_vel(rot) {}
+
+}; // end of struct Telemetry
+
+
+/// @brief The ring passing a controller's updates to the GUI
+///        (enough for several seconds of updates).  @since 0.3.3
+typedef RingBuffer<Telemetry, 1024> TelemetryRing;
+
+#endif // QTCTRL_TELEMETRY
@@ -0,0 +1,84 @@
+/**
+ ** @file  include/model/tripleBuffer.hpp
+ **
+ ** @brief Lock-free handoff of the last value between two threads.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_TRIPLE_BUFFER
+#define QTCTRL_TRIPLE_BUFFER
+
+#include <atomic>
+
+
+/**
+ ** @brief TripleBuffer gives the last value written by a thread
+ **        to another thread, without lock nor wait.
+ **
+ ** The writer fills its own buffer, then exchanges it with the middle
+ ** one; the reader exchanges its own buffer with the middle one when
+ ** it has been written since its last read.  Both exchanges are
+ ** atomic: the reader always gets a complete value, the last written
+ ** one, and older values are simply overwritten (never queued).
+ **
+ ** @warning There should be only one writer thread and one reader
+ **          thread.
+ **
+ ** @param T  the class of the values (copiable).
+ **
+ ** @since 0.3.3
+ */
+template<class T>
+class TripleBuffer {
+  /// @brief The flag of the middle index, set when it was written.
+  static const int fresh = 4;
+
+  T buffers[3];               ///< @brief The three buffers.
+  /// @brief The index of the middle buffer (with the fresh flag).
+  std::atomic<int> middle;
+  int back;                   ///< @brief The index of the writer's.
+  int front;                  ///< @brief The index of the reader's.
+
+public:
+  /// @brief The default constructor gives default values,
+  ///        and nothing to read.
+  TripleBuffer() : middle(1), back(0), front(2) {}
+
+  /** @brief Writes a new value (by the writer thread only).
+   **
+   ** @param value  the new value.
+   **/
+  void write(const T& value) {
+    buffers[back] = value;
+    // the written buffer becomes the middle one (release)
+    back = middle.exchange(back | fresh, std::memory_order_acq_rel)
+      & ~fresh;
+  } // end of void write(const T&)
+
+  /** @brief Reads the last value, if a new one was written
+   **        (by the reader thread only).
+   **
+   ** @param value  the last value, changed only if a new one
+   **               was written since the last read.
+   **
+   ** @return  whether a new value was written (and read).
+   **/
+  bool read(T& value) {
+    if ( !(middle.load(std::memory_order_relaxed) & fresh) )
+      return false;
+    // the middle buffer becomes the reader's one (acquire)
+    front = middle.exchange(front, std::memory_order_acq_rel) & ~fresh;
+    value = buffers[front];
+    return true;
+  } // end of bool read(T&)
+
+  /// @brief Tells whether a new value was written since the last
+  ///        read (by the reader thread, without reading it).
+  /// @return  whether a new value can be read.
+  bool written() const
+  { return middle.load(std::memory_order_relaxed) & fresh; }
+
+}; // end of class TripleBuffer
+
+#endif // QTCTRL_TRIPLE_BUFFER
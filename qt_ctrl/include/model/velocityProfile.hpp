@@ -0,0 +1,101 @@
+/**
+ ** @file  include/model/velocityProfile.hpp
+ **
+ ** @brief Velocity profile along a path.
+ **
+ ** @date  October 2026
+ **/
+
+#ifndef QTCTRL_VELOCITY_PROFILE
+#define QTCTRL_VELOCITY_PROFILE
+
+#include <vector>
+#include <algorithm>
+#include <math.h>                   // to get sqrt() declaration
+#include <iSeeML/rob/CompoundPath.hpp>
+#include <model/motion.hpp>
+
+
+/**
+ ** @brief VelocityProfile gives the fastest translation velocity
+ **        along a path which respects the limits of a
+ **        @ref MotionModel "motion model".
+ **
+ ** The path is sampled at regular arc lengths.  At each sample,
+ ** the velocity is bounded by the maximum translation velocity,
+ ** by the maximum rotation velocity over the curvature, and by
+ ** the rotation acceleration due to the change of curvature.
+ ** A forward pass then limits the translation acceleration
+ ** (starting at rest) and a backward pass the deceleration
+ ** (stopping at the end).
+ **
+ ** The profile is @ref compute "computed" once per path:
+ ** a @ref velocity "velocity" is then interpolated between two
+ ** samples, in constant time: it is the velocity reached by
+ ** accelerating from the previous sample or braking before the next
+ ** one, which is exact along the segments of a path.
+ ** Once a path is computed, a shorter one (as a replanned path)
+ ** is computed without any allocation.
+ **
+ ** @since 0.3.3
+ */
+class VelocityProfile {
+  /// @brief The arc length between two samples.
+  double step;
+  /// @brief The maximum translation acceleration.
+  double max_acc;
+  /// @brief The maximum translation deceleration (positive).
+  double max_dec;
+  /// @brief The velocities at the samples.
+  std::vector<double> velocities;
+  /// @brief The samples' arc lengths, configurations and curvatures
+  ///        (kept from one @ref compute to the next one: they are
+  ///        only reallocated when a longer path is sampled).
+  std::vector<double> arc_lengths, x, y, theta, kappa;
+
+public:
+  /// @brief The default constructor gives an empty profile (null
+  ///        velocity), which should be @ref compute "computed".
+  VelocityProfile() : step(1), max_acc(0), max_dec(0) {}
+
+  /** @brief Computes the profile along the given path.
+   **
+   ** @param path   the path,
+   ** @param model  the motion model of the robot,
+   ** @param ds     the arc length between two samples.
+   **/
+  void compute(const iSeeML::rob::CompoundPath& path,
+	       const MotionModel& model, const double& ds);
+
+  /// @brief Gives the length of the profile.
+  /// @return  the arc length of the last sample.
+  double length() const
+  { return velocities.empty() ? 0 : step * (velocities.size() - 1); }
+
+  /** @brief Gives the velocity at the given arc length.
+   **
+   ** @param s  the arc length along the path.
+   **
+   ** @return  the interpolated velocity, zero at the end
+   **          of the path (and after it).
+   **/
+  double velocity(const double& s) const {
+    const int last = velocities.size() - 1;
+    if (last < 1)
+      return 0;
+    const double u = (s < 0 ? 0 : s) / step;
+    const int i = (int) u;
+    if (i >= last)
+      return velocities[last];
+    // accelerating from the previous sample, braking before the next
+    // one, and remaining below the highest of them
+    const double v0 = velocities[i], v1 = velocities[i + 1],
+      d0 = (u - i) * step, d1 = step - d0;
+    return std::min( std::min( sqrt(v0 * v0 + 2 * max_acc * d0),
+			       sqrt(v1 * v1 + 2 * max_dec * d1) ),
+		     std::max(v0, v1) );
+  } // end of double velocity(const double&) const
+
+}; // end of class VelocityProfile
+
+#endif // QTCTRL_VELOCITY_PROFILE
@@ -0,0 +1,401 @@
+/**
+ * @file /src/cli/main.cpp
+ *
+ * @brief Command line runner of the controllers, without any window
+ *        (for batch tuning, e.g. on a server without X display).
+ *
+ * @date October 2026
+ **/
+
+#include <math.h>                   // to get ceil() declaration
+#include <stdlib.h>                 // to get strtod() declaration
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <QCoreApplication>
+#include <ctrl/file.hpp>
+#include <ctrl/smoothPath.hpp>
+#include <ctrl/goPID.hpp>
+#include <ctrl/imitate.hpp>
+#include <ctrl/PID.hpp>
+#include <ctrl/analytic.hpp>
+#include <model/fixedMotion.hpp>
+#include <model/simulator.hpp>
+#include <model/recorder.hpp>
+#include <model/ROS_node.hpp>
+
+
+// The controllers' names, in the order of the GUI's selection list
+// (the keyboard controller, first, cannot be used without window).
+static const int ctrl_nb = 7;
+static const char *ctrl_names[ctrl_nb] =
+  { "keyboard", "file", "pid-reach", "smooth-path", "imitate",
+    "pid-track", "analytic-track" };
+
+// Headers of the output file, as the GUI's (see DataWidget::names).
+static const char *output_names[] =
+  {"t", "x", "y", "theta", "v", "omega", "v", "omega"};
+
+/* Gives the value of a command line option, written "--name value"
+ * or "--name=value".
+ *
+ * Parameter argc  the arguments' count,
+ *           argv  the arguments' value,
+ *           name  the option's name (without "--").
+ *
+ * Returns the option's value, or NULL if it is not given.
+ */
+static const char* readOption(const int argc, char** argv,
+			      const char* name) {
+  const std::string option = std::string("--") + name;
+  for(int id = 1; id < argc; id++) {
+    const std::string arg = argv[id];
+    if ( (arg == option) && (id + 1 < argc) )
+      return argv[id + 1];
+    if (arg.compare(0, option.size() + 1, option + '=') == 0)
+      return argv[id] + option.size() + 1;
+  } // end of for (each argument)
+  return NULL;
+} // end of static const char* readOption(const int, char**, ...) ---
+
+/* Tells whether a command line flag ("--name") is given.
+ *
+ * Parameter argc  the arguments' count,
+ *           argv  the arguments' value,
+ *           name  the flag's name (without "--").
+ *
+ * Returns whether the flag is given.
+ */
+static bool readFlag(const int argc, char** argv, const char* name) {
+  const std::string flag = std::string("--") + name;
+  for(int id = 1; id < argc; id++)
+    if (flag == argv[id])
+      return true;
+  return false;
+} // end of static bool readFlag(const int, char**, const char*) ----
+
+/* Reads a list of numbers, separated by commas (or spaces).
+ *
+ * Parameter text    the list,
+ *           values  the numbers read (output),
+ *           nb_max  the maximum number of numbers.
+ *
+ * Returns the number of numbers read, or -1 if the list
+ * is not valid.
+ */
+static int readValues(const char* text, double values[],
+		      const int nb_max) {
+  int nb = 0;
+  char *end;
+  while ( (*text != '\0') && (nb < nb_max) ) {
+    values[nb++] = strtod(text, &end);
+    if (end == text)
+      return -1;
+    for(text = end; (*text == ',') || (*text == ' '); text++) ;
+  } // end of while (numbers to read)
+  return *text == '\0' ? nb : -1;
+} // end of static int readValues(const char*, double[], const int) -
+
+/* Gives the usage of this program.
+ *
+ * Parameter name  the program's name.
+ *
+ * Returns the exit status of a bad usage.
+ */
+static int usage(const char* name) {
+  std::cerr << "Usage: " << name << " [options] [ROS arguments]\n"
+    "Runs a controller without window, with ROS (e.g. Gazebo) or\n"
+    "with a simulated robot, and writes its motion as the GUI does.\n"
+    "Options:\n"
+    "  --ctrl NAME          controller (default pid-reach): file,\n"
+    "                       pid-reach, smooth-path, imitate,\n"
+    "                       pid-track or analytic-track\n"
+    "  --trajectory FILE    input file (file & tracking controllers)\n"
+    "  --goal X,Y,TH[,V,W]  goal of a reaching controller (angles\n"
+    "                       in degrees, default 10,10,0)\n"
+    "  --error X,Y,TH       initial error of a tracking controller\n"
+    "  --gains P,I,D,P,I,D  PID gains, translation then rotation\n"
+    "  --gains-file FILE    PID gains, one per line (as param.txt)\n"
+    "  --time-step DT       control time step (default 0.2 s)\n"
+    "  --substeps N         controller's substeps (default 1)\n"
+    "  --duration T         run duration (default 100 s)\n"
+    "  --output FILE        motion output file (default res.csv)\n"
+    "  --sim                simulate the robot instead of using ROS\n"
+    "  --init X,Y,TH        initial configuration of the simulated\n"
+    "                       robot (default 0,0,0)\n"
+    "  --ref FILE           reference trajectory: prints the\n"
+    "                       distance of the output's one to it\n"
+    "  --record FILE        records the simulated control, to be\n"
+    "                       replayed (ROS: parameter _record:=FILE)\n"
+    "  --replay FILE        replays a recording with the controller\n"
+    "                       (no robot nor output), and prints the\n"
+    "                       differences of its commands\n"
+    "  --tolerance EPS      commands' difference of a replay\n"
+    "                       (default 1E-9)\n"
+    "  --sync-replan        smooth-path waits for its replanned\n"
+    "                       paths (reproducible commands)\n";
+  return 2;
+} // end of static int usage(const char*) ----------------------------
+
+/* Writes the controller's updates as the GUI does: each state
+ * on a line, with the last commands.
+ *
+ * Parameter ctrl       the controller,
+ *           output     the output stream,
+ *           last_vel   the last commands (updated),
+ *           traject    the written states (updated).
+ */
+static void writeUpdates(Controller& ctrl, std::ostream& output,
+			 double last_vel[2],
+			 std::vector<State>& traject) {
+  Telemetry update;
+  while ( ctrl.pollTelemetry(update) )
+    if (update.kind == Telemetry::commandsUpdate) {
+      last_vel[0] = update.trans_vel;
+      last_vel[1] = update.rot_vel;
+    } else {
+      const State& state = update.state;
+      const iSeeML::rob::OrPtConfig& q = state.configuration();
+      output << state.date() << '\t' << q.position().xCoord() << '\t'
+	     << q.position().yCoord() << '\t' << q.orientation()
+	     << '\t' << state.translationVelocity() << '\t'
+	     << state.rotationVelocity() << '\t' << last_vel[0]
+	     << '\t' << last_vel[1] << '\n';
+      traject.push_back(state);
+    } // end of else (new state)
+} // end of static void writeUpdates(Controller&, std::ostream&, ...)
+
+/** @brief This is <tt>@ref index "qt_ctrl"</tt> command line
+ **        function, running a @ref Controller "controller"
+ **        with ROS or with a @ref ModelSimulator "simulated robot",
+ **        without any window.
+ **
+ ** Its options (see <tt>--help</tt>) replace the
+ ** @ref QtCtrlSelect "GUI's dialog", and the motion is written
+ ** in the format of the @ref DataWidget "GUI's output file".
+ ** With <tt>--replay</tt>, the controller @ref MotionReplay
+ ** "replays" a recording instead, and the differences of its
+ ** commands are printed.
+ ** @since 0.3.3
+ **
+ ** @param argc  The parameters' count, and
+ ** @param argv  the parameters' values, are both forwarded to ROS.
+ **
+ ** @return  Zero on success, one if the control could not run,
+ **          two on a bad usage, three if a replay's commands differ.
+ **/
+int main(int argc, char** argv) {
+  // Qt's threads need an application, not a display
+  QCoreApplication app(argc, argv);
+  const FixedMotionModel<QtCtrlLimits> motion_model;
+  const char *ctrl_opt = readOption(argc, argv, "ctrl"),
+    *file_opt = readOption(argc, argv, "trajectory"),
+    *output_opt = readOption(argc, argv, "output"),
+    *ref_opt = readOption(argc, argv, "ref"),
+    *gains_file = readOption(argc, argv, "gains-file"),
+    *record_opt = readOption(argc, argv, "record"),
+    *replay_opt = readOption(argc, argv, "replay"),
+    *opt;
+  const bool simulated = readFlag(argc, argv, "sim");
+  double time_step = .2, duration = 100, goal[5] = {10, 10, 0, 0, 0},
+    error[3] = {0, 0, 0}, init[3] = {0, 0, 0}, coef[6],
+    tolerance = 1E-9;
+  MotionReplay replay;
+  int ctrl_id = 2, nb_substeps = 1, id;
+
+  if ( readFlag(argc, argv, "help")
+       || ( (record_opt != NULL) && !simulated ) )
+    return usage(argv[0]);
+  // === controller's options ========================================
+  if (ctrl_opt != NULL) {
+    for(ctrl_id = 1; (ctrl_id < ctrl_nb)
+	  && (std::string(ctrl_opt) != ctrl_names[ctrl_id]); ctrl_id++) ;
+    if (ctrl_id == ctrl_nb) {
+      std::cerr << "Unknown controller '" << ctrl_opt << "'\n";
+      return usage(argv[0]);
+    } // end of if (unknown controller)
+  } // end of if (controller given)
+  if ( ( (opt = readOption(argc, argv, "time-step")) != NULL )
+       && ( (readValues(opt, &time_step, 1) != 1)
+	    || (time_step <= 0) ) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "substeps")) != NULL )
+       && ( (nb_substeps = atoi(opt)) < 1 ) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "duration")) != NULL )
+       && ( (readValues(opt, &duration, 1) != 1)
+	    || (duration <= 0) ) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "goal")) != NULL )
+       && (readValues(opt, goal, 5) < 3) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "error")) != NULL )
+       && (readValues(opt, error, 3) != 3) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "init")) != NULL )
+       && (readValues(opt, init, 3) != 3) )
+    return usage(argv[0]);
+  if ( ( (opt = readOption(argc, argv, "tolerance")) != NULL )
+       && ( (readValues(opt, &tolerance, 1) != 1)
+	    || (tolerance < 0) ) )
+    return usage(argv[0]);
+  if (replay_opt != NULL) {  // the recorded controller's time step
+    if ( !replay.load(replay_opt) ) {
+      std::cerr << "Cannot read the recording " << replay_opt << '\n';
+      return 1;
+    } // end of if (no recording)
+    time_step = replay.timeStep();
+  } // end of if (replay)
+  // the default PID gains are the GUI's original ones [DP96]
+  coef[0] = 1 / (.35 * .35);  coef[1] = 1 / .35;  coef[2] = 0;
+  coef[3] = 1 / (time_step * time_step);
+  coef[4] = 1 / time_step;  coef[5] = 0;
+  if (gains_file != NULL) {
+    std::ifstream gains(gains_file);
+    for(id = 0; (id < 6) && (gains >> coef[id]); id++) ;
+    if (id < 6) {
+      std::cerr << "Cannot read six gains from " << gains_file << '\n';
+      return 1;
+    } // end of if (missing gains)
+  } // end of if (gains' file)
+  if ( ( (opt = readOption(argc, argv, "gains")) != NULL )
+       && (readValues(opt, coef, 6) != 6) )
+    return usage(argv[0]);
+  if ( ( (ctrl_id == 1) || (ctrl_id > 3) )
+       && ( (file_opt == NULL) || !std::ifstream(file_opt) ) ) {
+    std::cerr << "Controller '" << ctrl_names[ctrl_id]
+	      << "' needs a readable --trajectory file\n";
+    return 1;
+  } // end of if (missing input file)
+  // === the controller, as the GUI's dialog builds it ===============
+  const State goal_state( 0, iSeeML::rob::OrPtConfig
+			  ( iSeeML::geom::Point(goal[0], goal[1]),
+			    iSeeML::Object::deg2rad(goal[2]) ), goal[3],
+			  iSeeML::Object::deg2rad(goal[4]) );
+  const iSeeML::rob::OrPtConfig error_config
+    ( iSeeML::geom::Point(error[0], error[1]),
+      iSeeML::Object::deg2rad(error[2]) );
+  Controller *controller;
+  switch (ctrl_id) {
+  case 1:
+    controller = new FileCtrl(motion_model, time_step, file_opt);
+    break;
+  case 2:
+    controller = new PIDreachCtrl(motion_model, time_step,
+				  goal_state, coef);
+    break;
+  case 3:
+    controller = new SmoothPathCtrl(motion_model, time_step,
+				    goal_state);
+    break;
+  case 4:
+    controller = new ImitateCtrl(motion_model, time_step, file_opt,
+				 error_config);
+    break;
+  case 5:
+    controller = new PIDCtrl(motion_model, time_step, file_opt,
+			     error_config, coef);
+    break;
+  default:
+    controller = new AnalyticCtrl(motion_model, time_step, file_opt,
+				  error_config);
+  } // end of switch (defining the new controller)
+  controller->setSubsteps(nb_substeps);
+  if ( (ctrl_id == 3) && readFlag(argc, argv, "sync-replan") )
+    static_cast<SmoothPathCtrl*>(controller)
+      ->setSynchronousReplanning(true);
+  if (replay_opt != NULL) {  // === the replay, instead of a control
+    const ReplayResult result = replay.run(*controller, tolerance);
+    delete controller;
+    std::cout << "commands:        " << result.nb_commands
+	      << "\nmax difference:  " << result.max_trans_diff << ' '
+	      << result.max_rot_diff << "\nmean difference: "
+	      << result.mean_trans_diff << ' ' << result.mean_rot_diff
+	      << "\nfirst difference: ";
+    if (result.first_diff < 0)
+      std::cout << "none" << std::endl;
+    else
+      std::cout << "command " << result.first_diff << std::endl;
+    return result.first_diff < 0 ? 0 : 3;
+  } // end of if (replay)
+  // === the control, written as the GUI's output ====================
+  std::ofstream output(output_opt == NULL ? "res.csv" : output_opt);
+  std::vector<State> traject;
+  double last_vel[2] = {0, 0};
+  if (!output) {
+    std::cerr << "Cannot write into "
+	      << (output_opt == NULL ? "res.csv" : output_opt) << '\n';
+    delete controller;
+    return 1;
+  } // end of if (no output)
+  for(id = 0; id < 8; id++)
+    output << output_names[id] << (id < 7 ? '\t' : '\n');
+  if (simulated) {  // as Simulator::run, reading the updates
+    const ModelSimulator< FixedMotionModel<QtCtrlLimits> >
+      simulator(motion_model);
+    // number of time steps, avoiding rounding errors
+    const int nb_steps = (int) ceil(duration / time_step - 1E-9);
+    State state( 0, iSeeML::rob::OrPtConfig
+		 ( iSeeML::geom::Point(init[0], init[1]),
+		   iSeeML::Object::deg2rad(init[2]) ), 0, 0 );
+    double trans_vel, rot_vel;
+    std::ostringstream log_str;  // logs are ignored
+    MotionRecorder recorder;  // as the ROS node's one
+    if ( (record_opt != NULL) && !recorder.open(record_opt, time_step) )
+      std::cerr << "Cannot record into " << record_opt << '\n';
+    const ReachingCtrl *reach_ctrl
+      = dynamic_cast<const ReachingCtrl*>(controller);
+    if ( recorder.isOpen() && (reach_ctrl != NULL) )
+      recorder.goal( reach_ctrl->getGoal() );  // for the replay
+    controller->stopMotion();
+    controller->newState(state);
+    if ( recorder.isOpen() )
+      recorder.state(state);
+    for(id = 0; id < nb_steps; id++) {
+      log_str.str("");
+      controller->chooseVelocities(trans_vel, rot_vel, log_str);
+      if ( recorder.isOpen() )
+	recorder.command(controller->cycleTime(), trans_vel, rot_vel);
+      state = simulator.step(state, trans_vel, rot_vel, time_step);
+      controller->newState(state);
+      if ( recorder.isOpen() )
+	recorder.state(state);
+      writeUpdates(*controller, output, last_vel, traject);
+    } // end of for (each time step)
+  } else {  // with ROS: the ROS node runs the control loop
+    ROSnode ctrl_node(argc, argv);
+    ctrl_node.init(*controller);
+    if ( !ctrl_node.connected() ) {
+      std::cerr << "Cannot connect to the ROS master\n";
+      delete controller;
+      return 1;
+    } // end of if (no ROS)
+    const std::chrono::steady_clock::time_point end =
+      std::chrono::steady_clock::now() + std::chrono::microseconds
+      ( (long long)(duration * 1E6) );
+    // the updates are read at the GUI's rate, until the end or ^C
+    while ( ros::ok() && (std::chrono::steady_clock::now() < end) ) {
+      std::this_thread::sleep_for
+	( std::chrono::milliseconds(1000 / 60) );
+      writeUpdates(*controller, output, last_vel, traject);
+      ctrl_node.flushLogs();
+    } // end of while (running)
+    ctrl_node.end();
+    writeUpdates(*controller, output, last_vel, traject);
+  } // end of else (with ROS)
+  output.close();
+  delete controller;
+  if (ref_opt != NULL) {  // as PID/PID.py
+    std::vector<State> reference;
+    if ( !Simulator::readTrajectory(ref_opt, reference) ) {
+      std::cerr << "Cannot read the reference " << ref_opt << '\n';
+      return 1;
+    } // end of if (no reference)
+    std::cout << Simulator::distance(traject, reference) << std::endl;
+  } // end of if (reference given)
+  return 0;
+} // end of int main(int, char**) ------------------------------------
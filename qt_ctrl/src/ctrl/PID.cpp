@@ -13,8 +13,8 @@
 // Cf Controller::chooseVelocities(...)
 void PIDCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
 			       std::ostream& log_str) {
-  // updates the goal to be one time step after the robot's date
-  searchGoal(time_step);
+  // updates the goal to be one cycle after the robot's date
+  searchGoal(cycle_time);
   const iSeeML::rob::OrPtConfig& robot_cfg = state.configuration(),
     goal_cfg = (*goal)->configuration();
   const State new_goal( (*goal)->date(),
@@ -23,6 +23,8 @@ void PIDCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
 			(*goal)->rotationVelocity() );
   // sets the goal of the local controller, in the robot's frame
   reachCtrl.changeGoal(new_goal);
-  // uses the local controller
+  // uses the local controller, with the same cycle
+  reachCtrl.setCycleTime(cycle_time);
+  reachCtrl.setSubsteps(nb_substeps);
   reachCtrl.chooseVelocities(trans_vel, rot_vel, log_str);
 } // end of void PIDCtrl::chooseVelocities(double&, double&, ...) ----
@@ -22,13 +22,13 @@ void AnalyticCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
     goal_vel = (*goal)->translationVelocity(),
     max_curv = 1,  // === get a better value !!! ===
     trans_acc = motion_model.limAcc(0, dist, vel,
-				    goal_vel, time_step),
+				    goal_vel, cycle_time),
     rot_acc = 0;   // === get a better value !!! ===
   // =================================================================
   // gets the goal's velocities
   motion_model.applyAccelerations
     (moving_velocity, turning_velocity,
-     trans_acc, rot_acc, time_step);
+     trans_acc, rot_acc, cycle_time);
   // updates the parameters and send the update signal
   updateVelocities(trans_vel, rot_vel);
 } // end of void AnalyticCtrl::chooseVelocities(double&, ...) --------
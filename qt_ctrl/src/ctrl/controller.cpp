@@ -14,14 +14,14 @@
  * This method can be overwritten by inheritors.
  */
 void Controller::newState(const State& state) {
-  static State last_state(state); 
+  // last_state is a field: controllers may run in parallel threads
   // new update: moved of 1 cm or .1 second elapsed
   if ( (state.configuration().position()
 	.sqrDist( last_state.configuration().position() ) > 0.0001)
        || (state.date() - last_state.date() > .1)
        || firstOdometry() ) { 
-    // signal the GUI for state display (replace logging)
-    stateUpdated(state);  // send for display
+    // give the GUI the state for display (replace logging)
+    telemetry.push( Telemetry(state) );
     last_state = state;
     if ( firstOdometry() )    // if first odometry data,
       changeFirstOdometry();  // not any more
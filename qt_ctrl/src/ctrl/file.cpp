@@ -13,10 +13,10 @@
 // Cf Controller::chooseVelocities(...)
 void FileCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
 				std::ostream& log_str) {
-  static double remain_dur = 0, duration, moving_acc, turning_acc; 
+  double duration;  // accelerations are fields (several instances)
   if ( inputOK() ) {  // only works if input file is OK
     // when needed, get new accelerations from file
-    if ( remain_dur < timeStep() ) {
+    if ( remain_dur < cycleTime() ) {
       // read new line in input stream
       *input >> duration >> moving_acc >> turning_acc;
       if ( inputEnded() )  // stop at the end of file
@@ -25,12 +25,12 @@ void FileCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
     } // apply accelerations during time step to fin future velocities
     motion_model.applyAccelerations
       (moving_velocity, turning_velocity,
-       moving_acc, turning_acc, time_step);
+       moving_acc, turning_acc, cycle_time);
     /* log when needed 
     log_str << "+(" << moving_acc << ", " << turning_acc
-    << ", " << time_step << "/" << remain_dur << ")"; */
+    << ", " << cycle_time << "/" << remain_dur << ")"; */
     // set velocities
     updateVelocities(trans_vel, rot_vel); 
-    remain_dur -= timeStep();  // decrease remaining time
+    remain_dur -= cycleTime();  // decrease remaining time
   } // end of if (input OK)
 } // end of void FileCtrl::chooseVelocities(double&, double&, ...) ---
@@ -15,32 +15,41 @@ void PIDreachCtrl::chooseVelocities(double& trans_vel, double& rot_vel,
 				    std::ostream& log_str) {
   // gets the goal
   const State& goal = getGoal();  
-  // estimate the distance and angle difference to goal's config,
-  // as well as its derivative and its integration
-  const iSeeML::rob::OrPtConfig& goal_config = goal.configuration(),
-    config = state.configuration();
-  const iSeeML::geom::Vector v
-    = goal_config.position() - config.position(); 
-  const double dist = v.length(), dir = v.orientation(),
-    // === Following formula may be changed ==========================
-    angle_diff = iSeeML::Object::mod2pi( dir + goal_config.orientation()
-					 - config.orientation() ),
-    trans_vel_diff = goal.translationVelocity()
-    - state.translationVelocity(),
-    rot_vel_diff = goal.rotationVelocity()
-    - state.rotationVelocity();
-  // =================================================================
-  integr_dist += dist * time_step;
-  integr_angle_diff += angle_diff * time_step; 
-  // computes the accelerations
-  const double trans_acc = trans_prop_coef * dist + trans_deriv_coef 
-    * trans_vel_diff + trans_integ_coef * integr_dist,
-    rot_acc = rot_prop_coef * angle_diff + rot_deriv_coef 
-    * rot_vel_diff + rot_integ_coef * integr_angle_diff;
-  // gets the goal's velocities
-  motion_model.applyAccelerations
-    (moving_velocity, turning_velocity,
-     trans_acc, rot_acc, time_step);
+  const iSeeML::rob::OrPtConfig& goal_config = goal.configuration();
+  // duration of a substep, and state predicted at its beginning
+  const double sub_step = cycle_time / nb_substeps;
+  State current(state);
+
+  for(int id = 0; id < nb_substeps; id++) {
+    if (id > 0)  // follows the velocities of the previous substep
+      current = predictedState(current, sub_step);
+    // estimate the distance and angle difference to goal's config,
+    // as well as its derivative and its integration
+    const iSeeML::rob::OrPtConfig& config = current.configuration();
+    const iSeeML::geom::Vector v
+      = goal_config.position() - config.position(); 
+    const double dist = v.length(), dir = v.orientation(),
+      // === Following formula may be changed ========================
+      angle_diff = iSeeML::Object::mod2pi( dir
+					   + goal_config.orientation()
+					   - config.orientation() ),
+      trans_vel_diff = goal.translationVelocity()
+      - current.translationVelocity(),
+      rot_vel_diff = goal.rotationVelocity()
+      - current.rotationVelocity();
+    // ===============================================================
+    integr_dist += dist * sub_step;
+    integr_angle_diff += angle_diff * sub_step; 
+    // computes the accelerations
+    const double trans_acc = trans_prop_coef * dist + trans_deriv_coef
+      * trans_vel_diff + trans_integ_coef * integr_dist,
+      rot_acc = rot_prop_coef * angle_diff + rot_deriv_coef 
+      * rot_vel_diff + rot_integ_coef * integr_angle_diff;
+    // gets the goal's velocities
+    motion_model.applyAccelerations
+      (moving_velocity, turning_velocity,
+       trans_acc, rot_acc, sub_step);
+  } // end of for (each substep)
   // updates the parameters and send the update signal
   updateVelocities(trans_vel, rot_vel);
 } // end of void PIDreachCtrl::chooseVelocities(double&, ...) --------
@@ -7,83 +7,65 @@
  ** @date  June 2019
  **/
 
+#include <vector>
 #include <ctrl/smoothPath.hpp>
-#include <iSeeML/rob/ArrayPaths.hpp>
 
 // Cf ReachingCtrl::setGoal(const State&)
 void SmoothPathCtrl::setGoal(const State& goal) {
-  // motion model cannot change => static const data
-  static const double&
-    max_trans_vel  = motion_model.maxTranslVel(),
-    norm_dist      = max_trans_vel * max_trans_vel / 2,
-    acc_dist       = norm_dist / motion_model.maxTranslAcc(),
-    dec_dist       = - norm_dist / motion_model.minTranslAcc(),
-    max_curv       = motion_model.maxRotVel() / max_trans_vel,
-    max_rot_acc    = std::min( motion_model.maxRotAcc(),
-			       -motion_model.minRotAcc() ),
-    max_curv_deriv = max_rot_acc / max_trans_vel;
-  
   ReachingCtrl::setGoal(goal);
   const iSeeML::rob::OrPtConfig start = state.configuration()
     + iSeeML::rob::OrPtConfig(acc_dist, 0, 0),
     end = getGoal().configuration()
     + iSeeML::rob::OrPtConfig(- dec_dist, 0, 0);
-  path = iSeeML::rob::FscPath(start, end, max_curv, max_curv_deriv);
+  // the path gets its parameters, then is connected
+  path = FscValues::path(start, max_curv, max_curv_deriv);
+  connector.connect(path, start, end);
+  path_index.build(path);
+  global_path.set(path, acc_dist, dec_dist);
+  replanner.cancel();  // the path of the previous goal is dropped
+  replan_distance = 0;
+  profile.compute(global_path, motion_model,
+		  time_step * max_trans_vel / 2);
   total_distance = acc_dist + path.length() + dec_dist;
   distance = 0;
+  prev_state = state;  // the distance is covered from here
   pathChanged();  // signal the path changed
 } // end of SmoothPathCtrl::setGoal(const State&) --------------------
 
-// Get the path to the aimed oriented point.
-// Return The path to the aimed oriented point.
-const iSeeML::rob::Path& SmoothPathCtrl::getPath() const {
-  // motion model cannot change => static const data
-  static const double&
-    max_trans_vel  = motion_model.maxTranslVel(),
-    norm_dist      = max_trans_vel * max_trans_vel / 2,
-    acc_dist       = norm_dist / motion_model.maxTranslAcc(),
-    dec_dist       = - norm_dist / motion_model.minTranslAcc();
-  // the path is made of three paths
-  static iSeeML::rob::ArrayPaths globalPath(3);
-  // first one is a segment
-  const iSeeML::rob::OrPtConfig start = path.start() +
-    iSeeML::rob::OrPtConfig(- acc_dist, 0, 0); 
-  globalPath.setPath( 0, true, new iSeeML::rob::LinCurvPath
-		      ( iSeeML::rob::CurvConfig(start, 0),
-			0, acc_dist ) );
-  // second one is the saved path
-  globalPath.setPath( 1, false, (iSeeML::rob::Path*)( &path.clone() ) );
-  // third one is another segment
-  globalPath.setPath( 2, true, new iSeeML::rob::LinCurvPath
-		      ( iSeeML::rob::CurvConfig(path.end(), 0),
-			0, dec_dist ) );
-} // end of const iSeeML::rob::Path& SmoothPathCtrl::getPath() const -
   
+/* Sets the next state of a list of states, reusing its elements:
+ * states and list's nodes are only allocated when the list grows.
+ *
+ * Parameter traject  the list of states,
+ *           next     the next element to set (changed to the next
+ *                     one, remains the end of the list if it grows),
+ *           state    the value of the state.
+ */
+static void setNextState(std::list<State*>& traject,
+			 std::list<State*>::iterator& next,
+			 const State& state) {
+  if ( next == traject.end() )
+    traject.push_back( new State(state) );
+  else
+    **(next++) = state;
+} // end of static void setNextState(std::list<State*>&, ...) --------
+
 /// Transform the planned path into an aimed trajectory.
 /// Return The trajectory obtained from the planned path.
 const std::list<State*>& SmoothPathCtrl::getAimedTrajectory() const {
-  // motion model cannot change => static const data
-  static const double&
-    max_trans_acc = motion_model.maxTranslAcc(),
+  const double max_trans_acc = motion_model.maxTranslAcc(),
     max_trans_dec = motion_model.minTranslAcc(),
-    max_trans_vel  = motion_model.maxTranslVel(),
-    norm_dist      = max_trans_vel * max_trans_vel / 2,
-    acc_dist       = norm_dist / max_trans_acc,
-    dec_dist       = - norm_dist / max_trans_dec;
-  const double l = path.length(), dt2 = time_step / 2; 
-  double t = 0, v = 0, om = 0, d = - acc_dist, tmp;
-  // this static variable remains defined until the end
-  static std::list<State*> traject;
-  // empty the list, to recompute it
-  while (! traject.empty() ) {
-    free( traject.front() );
-    traject.pop_front();
-  } // recompute the list
+    l = path.length(), dt2 = time_step / 2; 
+  double t = 0, v = 0, d = - acc_dist, tmp;
+  // the members traject and samples' vectors keep their memory
+  std::list<State*>::iterator next = traject.begin();
+  int nb_samples, id;
+  // recompute the list, reusing its states
   tmp = max_trans_acc * time_step; 
   while (d < 0) { // handle the first linear part
     iSeeML::rob::OrPtConfig q = path.start() +
       iSeeML::rob::OrPtConfig(d, 0, 0);
-    traject.push_back( new State(t, q, v, 0) );
+    setNextState( traject, next, State(t, q, v, 0) );
     // prepare the next one
     t += time_step;
     d += v * time_step + tmp * dt2;
@@ -91,13 +73,26 @@ const std::list<State*>& SmoothPathCtrl::getAimedTrajectory() const {
   } // distance and velocity need correction
   d -= (v - max_trans_vel) * dt2;
   v = max_trans_vel;
-  tmp = v * time_step;
-  while (d < l) { // add the current state
-    iSeeML::rob::CurvConfig q = path[d]; 
-    traject.push_back( new State(t, q, v, q.curvature() * v) );
-    // prepare the next one
+  arc_lengths.clear();  vels.clear();
+  while (d < l) { // arc lengths and velocities of the path's samples
+    arc_lengths.push_back(d);  vels.push_back(v);
+    d += v * time_step;
+    // at least a tenth of the maximum velocity, to remain short
+    v = std::max( profile.velocity(acc_dist + d), max_trans_vel / 10 );
+  } // the path is sampled at once
+  v = max_trans_vel;  // the last segment starts at maximum velocity
+  nb_samples = arc_lengths.size();
+  x.resize(nb_samples);      y.resize(nb_samples);
+  theta.resize(nb_samples);  kappa.resize(nb_samples);
+  if (nb_samples > 0)
+    path.sample(&arc_lengths[0], nb_samples, &x[0], &y[0],
+		&theta[0], &kappa[0]);
+  for(id = 0; id < nb_samples; id++) { // add the current state
+    setNextState( traject, next,
+		  State(t, iSeeML::rob::OrPtConfig(x[id], y[id],
+						    theta[id]),
+			vels[id], kappa[id] * vels[id]) );
     t += time_step;
-    d += tmp;
   } // distance and velocity need correction
   d -= l; 
   tmp = sqrt(-2 * d * max_trans_dec);
@@ -107,7 +102,7 @@ const std::list<State*>& SmoothPathCtrl::getAimedTrajectory() const {
   while (v > 0) { // handle the last linear part
     iSeeML::rob::OrPtConfig q = path.end() +
       iSeeML::rob::OrPtConfig(d, 0, 0);
-    traject.push_back( new State(t, q, v, 0) );
+    setNextState( traject, next, State(t, q, v, 0) );
     // prepare the next one
     t += time_step;
     d += v * time_step + tmp * dt2;
@@ -115,7 +110,12 @@ const std::list<State*>& SmoothPathCtrl::getAimedTrajectory() const {
   }
   iSeeML::rob::OrPtConfig q = path.end() +
     iSeeML::rob::OrPtConfig(dec_dist, 0, 0);
-  traject.push_back( new State(t, q, 0, 0) );
+  setNextState( traject, next, State(t, q, 0, 0) );
+  // remove the states of the previous trajectory which remain
+  while ( next != traject.end() ) {
+    delete *next;
+    next = traject.erase(next);
+  }
   return traject; 
 } // end of const SmoothPathCtrl::getAimedTrajectory() const
  
@@ -123,21 +123,12 @@ const std::list<State*>& SmoothPathCtrl::getAimedTrajectory() const {
 void SmoothPathCtrl::chooseVelocities(double& trans_vel,
 				      double& rot_vel,
 				      std::ostream& log_str) {
-  static const double&
-    max_trans_acc = motion_model.maxTranslAcc(),
-    max_trans_dec = motion_model.minTranslAcc(),
-    max_trans_vel  = motion_model.maxTranslVel(),
-    norm_dist      = max_trans_vel * max_trans_vel / 2,
-    acc_dist       = norm_dist / max_trans_acc,
-    dec_dist       = - norm_dist / max_trans_dec,
-    max_rot_acc    = motion_model.maxRotAcc(),
-    max_rot_dec    = motion_model.minRotAcc(),
-    max_rot_vel    = motion_model.maxRotVel();
-  static State last_state = state;
+  const double max_trans_acc = motion_model.maxTranslAcc(),
+    max_trans_dec = motion_model.minTranslAcc();
   trans_vel = state.translationVelocity();  // current velocity
   // update the covered distance
-  distance += ( trans_vel + last_state.translationVelocity() )
-    * ( state.date() - last_state.date() ) / 2;
+  distance += ( trans_vel + prev_state.translationVelocity() )
+    * ( state.date() - prev_state.date() ) / 2;
   /* ### 1st solution: compute the desired velocities; NOT GOOD ######
   // === compute desired translation velocity ========================
   // choose between accelerate, remain or brake
@@ -168,12 +159,12 @@ void SmoothPathCtrl::chooseVelocities(double& trans_vel,
   ### 2nd solution: compute the desired accelerations; better? #### */
   if (distance <= acc_dist)                        // first part
     motion_model.applyAccelerations(moving_velocity, turning_velocity,
-				    max_trans_acc, 0, time_step);
+				    max_trans_acc, 0, cycle_time);
   else if (distance >= total_distance)             // stop
     stopMotion();
   else if (distance >= total_distance - dec_dist)  // last part
     motion_model.applyAccelerations(moving_velocity, turning_velocity,
-				    max_trans_dec, 0, time_step);
+				    max_trans_dec, 0, cycle_time);
   else {                                          // path part
     /* 3rd solution: get directly from path with anticipation
     const double defl =  // desired change of orientation
@@ -182,32 +173,51 @@ void SmoothPathCtrl::chooseVelocities(double& trans_vel,
       rot_acc = defl / time_step - state.translationVelocity();
     motion_model.applyAccelerations(moving_velocity, turning_velocity,
     0, rot_acc, time_step); */
-    const double lookahead = time_step * max_trans_vel,
+    const double lookahead = cycle_time * max_trans_vel,
       arc_length = distance - acc_dist + lookahead;
     // path's length is a little bit too much (seg. fault): - 10⁻⁶
     double length = path.length() - 1E-6, s = arc_length > length
-      ? length : arc_length, curv = path[s].curvature();
+      ? length : arc_length, curv = path_index.next(s).curvature();
     // -=# recompute the path to improve it #=- 
-    if (fabs(curv) < path.maxCurv() * 1E-3)  // very small curvature
+    if (fabs(curv) > path.maxCurv() * 1E-2)  // out of a straight part:
+      replan_distance = distance;  // replanning allowed again
+    if ( (fabs(curv) < path.maxCurv() * 1E-3)  // very small curvature
+	 && (distance >= replan_distance) )  // and not replanned yet
       /* next constraint not strong enough!!!
 	 && (arc_length < length * 2 / 3) ) {  // and not too far
       // recompute from here
       path.connect( state.configuration(), path.end() );*/ {
-      iSeeML::rob::FscPath
-	new_path( state.configuration(), path.end(),
-		  path.maxCurv(), path.maxCurvDeriv() );
       // not much longer than what remains along older path
-      if (new_path.length() < 1.2 * (length - distance + acc_dist) ) { 
-	path = new_path;  // no long loop => copy
-	// change the considered distance (beginning of the path)
-	distance = acc_dist;  // and the computed values
-	length = path.length() - 1E-6;
-	total_distance = acc_dist + length + dec_dist;
-	s = lookahead > length ? length : lookahead;
-	curv = path[s].curvature();
-      } } // -=# NOW WORKs: remains closer without loops #=- 
-    moving_velocity  = max_trans_vel;
-    turning_velocity = max_trans_vel * curv;
+      const double max_length = 1.2 * (length - distance + acc_dist),
+	// estimated length (negative if unknown)
+	estimate = length_table ? length_table->length
+	( state.configuration(), path.end() ) : -1;
+      if (estimate < max_length)  // only planned if worth it
+	replanner.request( path, state.configuration(), path.end(),
+			   max_length, distance );
+      // not requested again before covering replan_gap
+      replan_distance = distance + replan_gap;
+    } // the new path is only taken when ready (and shorter)
+    // waiting for the new path during the budget at most
+    double req_distance;  // distance covered when requested
+    if ( replanner.take(path, req_distance, replan_budget) ) {
+      path_index.build(path);  // pieces were reallocated
+      global_path.set(path, acc_dist, dec_dist);
+      profile.compute( global_path, motion_model,
+		       time_step * max_trans_vel / 2 );
+      // change the considered distance (beginning of the path, plus
+      // what was covered while planning) and the computed values
+      distance = acc_dist + distance - req_distance;
+      replan_distance = distance + replan_gap;
+      length = path.length() - 1E-6;
+      total_distance = acc_dist + length + dec_dist;
+      s = distance - acc_dist + lookahead;
+      s = s > length ? length : s;
+      curv = path_index.next(s).curvature();
+    } // -=# NOW WORKs: remains closer without loops #=- 
+    // velocity at the anticipated arc length, bounded by the profile
+    moving_velocity  = profile.velocity(acc_dist + s);
+    turning_velocity = moving_velocity * curv;
   } /*
   // === log for debug ===============================================
   log_str << "Vel. @d = " << distance << " [" << acc_dist
@@ -215,6 +225,6 @@ void SmoothPathCtrl::chooseVelocities(double& trans_vel,
 	  << "]: " << moving_velocity << ", " << turning_velocity; */
   // === updates the parameters and send the update signal ===========
   updateVelocities(trans_vel, rot_vel);
-  // === updates the last state variable =============================
-  last_state = state;
+  // === updates the previous state variable =========================
+  prev_state = state;
 } // end of SmoothPathCtrl::chooseVelocities(double&, double&, ...)
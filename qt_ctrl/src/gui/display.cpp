@@ -24,12 +24,15 @@ const char *DataWidget::names[] =
  */
 DataWidget::DataWidget(QWidget& parent)
   : QWidget(&parent), output(NULL), motion_GUI() {
-  // the widget is split vertically in two group boxes
+  // the widget is split vertically in three group boxes
   QVBoxLayout *layout = new QVBoxLayout(this);
   QGroupBox *odom_box = new QGroupBox( tr("Odometry"), this),
-    *cmd_box = new QGroupBox( tr("Commands"), this), *a_box;
+    *cmd_box = new QGroupBox( tr("Commands"), this),
+    *timing_box = new QGroupBox( tr("Loop timing"), this), *a_box;
   layout->addWidget(odom_box);
   layout->addWidget(cmd_box);
+  layout->addWidget(timing_box);
+  ( new QVBoxLayout(timing_box) )->addWidget(&timing_label);
   QGridLayout *odom_layout = new QGridLayout(odom_box),
     *cmd_layout = new QGridLayout(cmd_box), *a_layout;
   static const char *init_val = "----.--";
@@ -82,13 +85,15 @@ void DataWidget::setLabels(const Labels& offset, const Labels& nbData,
 
 // Update the display of the odometry.
 // Parameters odom  The odometry data.  Since 0.2.2.
-void DataWidget::updateState(const State& state) {
+//            show  Whether the labels show it.  Since 0.3.3.
+void DataWidget::updateState(const State& state, const bool show) {
   const iSeeML::rob::OrPtConfig& q = state.configuration();
   const iSeeML::geom::Point&  P = q.position();
   const double data[] =
     {state.date(), P.xCoord(), P.yCoord(), q.orientation(), 
      state.translationVelocity(), state.rotationVelocity()};
-  setLabels(tOdom, nbOdoms, data);
+  if (show)
+    setLabels(tOdom, nbOdoms, data);
   motion_GUI.addState(state);
   if ( outputOK() ) {
     int idx;
@@ -100,12 +105,14 @@ void DataWidget::updateState(const State& state) {
 
 // Update the display of the controller's commands.
 // Parameters trans_vel  the translation velocity sent to ROS,
-//            rot_vel    the rotation velocity sent to ROS.
+//            rot_vel    the rotation velocity sent to ROS,
+//            show       whether the labels show them (since 0.3.3).
 // Since 0.3.1
 void DataWidget::updateCommands(const double& trans_vel,
-				const double& rot_vel) {
+				const double& rot_vel, const bool show) {
   const double data[] = {trans_vel, rot_vel};
   last_vel.setX(data[0]); 
   last_vel.setY(data[1]); 
-  setLabels(vCmd, nbCmds, data);
+  if (show)
+    setLabels(vCmd, nbCmds, data);
 } // end of void DataWidget::updateCommands(const Twist&) ------------
@@ -10,7 +10,9 @@
 #include <QGraphicsView>
 #include <QVBoxLayout>
 
-QtMotionGUI::QtMotionGUI() : motion_window(), not_first_state(false) {
+QtMotionGUI::QtMotionGUI()
+  : motion_window(), not_first_state(false), path_series(NULL),
+    trans_vel_series(NULL), rot_vel_series(NULL) {
   // Set the window's properties
   motion_window.setWindowTitle("Robot's Motion Overview");
   motion_window.setGeometry(200, 100, 800, 600);
@@ -28,6 +30,9 @@ QtMotionGUI::QtMotionGUI() : motion_window(), not_first_state(false) {
 
 void QtMotionGUI::addTrajectory(const std::list<State*>& trajectory) {
   static const Qt::GlobalColor traj_color = Qt::green;
+  // the trajectory has its own series, even if robot's states
+  // were drawn before it (the robot's next ones get new series too)
+  not_first_state = false;
   // adds each state of the trajectory, using traj_color
   for(std::list<State*>::const_iterator it = trajectory.begin();
       it != trajectory.end(); it++) {
@@ -41,45 +46,41 @@ void QtMotionGUI::addState(const State& state,
   static const int abscIdx = 0, ordoIdx = abscIdx + 1,
     timeIdx = ordoIdx + 1, tranIdx = timeIdx + 1,  // was previously
     rotaIdx = tranIdx + 1, nmbrIdx = rotaIdx + 1;  // an enum
-  if (not_first_state) { 
+  // Scalling factors
+  static const double factors[nmbrIdx]
+    = {50, 50, 25, 100, 300 / M_PI};
+  if (!not_first_state) {  // a new motion: new series
     // Setting the color
     const QPen motion_pen = QColor(motion_color);
-    // Scalling factors
-    static const double factors[nmbrIdx]
-      = {50, 50, 25, 100, 300 / M_PI};
-    // extract the data from the state
-    const iSeeML::rob::OrPtConfig old_q = last_state.configuration(),
-      q = state.configuration();
-    const iSeeML::geom::Point  old_P = old_q.position(),
-      P = q.position();
-    // add a new line to the path (and redraw it)
-    path_scene.addLine
-      ( factors[abscIdx] * old_P.xCoord(), - factors[ordoIdx]
-        * old_P.yCoord(), factors[abscIdx] * P.xCoord(),
-	- factors[ordoIdx] * P.yCoord(), motion_pen );
-    // add a new line to the translation velocity profile
-    trans_vel_scene.addLine
-      (factors[timeIdx] * last_state.date(),
-       - factors[tranIdx] * last_state.translationVelocity(),
-       factors[timeIdx] * state.date(),
-       - factors[tranIdx] * state.translationVelocity(), motion_pen);
-    // add a new line to the rotation velocity profile
-    rot_vel_scene.addLine
-      (factors[timeIdx] * last_state.date(),
-       - factors[rotaIdx] * last_state.rotationVelocity(),
-       factors[timeIdx] * state.date(),
-       - factors[rotaIdx] * state.rotationVelocity(), motion_pen);
-  } // end of if (not first state)
-  else {
+    path_series = new SeriesItem(SeriesItem::curve, motion_pen);
+    path_scene.addItem(path_series);
+    trans_vel_series = new SeriesItem(SeriesItem::timeSeries,
+				      motion_pen);
+    trans_vel_scene.addItem(trans_vel_series);
+    rot_vel_series = new SeriesItem(SeriesItem::timeSeries,
+				    motion_pen);
+    rot_vel_scene.addItem(rot_vel_series);
     not_first_state = true; 
-  } // end of else (first state)
-  // memorize the last state for future drawing
-  last_state = state;
+  } // end of if (first state)
+  // extract the data from the state
+  const iSeeML::geom::Point P = state.configuration().position();
+  // add a new point to the path (and redraw it)
+  path_series->append( QPointF( factors[abscIdx] * P.xCoord(),
+				- factors[ordoIdx] * P.yCoord() ) );
+  // add a new point to the translation velocity profile
+  trans_vel_series->append
+    ( QPointF( factors[timeIdx] * state.date(),
+	       - factors[tranIdx] * state.translationVelocity() ) );
+  // add a new point to the rotation velocity profile
+  rot_vel_series->append
+    ( QPointF( factors[timeIdx] * state.date(),
+	       - factors[rotaIdx] * state.rotationVelocity() ) );
 } // end of void QtMotionGUI::addState(double[]) ---------------------
 
 void QtMotionGUI::clear() {
   path_scene.clear();
   trans_vel_scene.clear();
-  rot_vel_scene.clear();
+  rot_vel_scene.clear();  // (the series are deleted)
+  path_series = trans_vel_series = rot_vel_series = NULL;
   not_first_state = false; 
 } // end of void QtMotionGUI::clear() --------------------------------
@@ -49,16 +49,18 @@ const char *QtCtrlSelect::default_save_name = "res";
  * for the future controller.
  *
  * Parameter  parent  the parent widget of the dialog,
- *            tm_stp  the future controller's time step,
- *            motion  the controller motion model.
+ *            tm_stp  the future controller's default time step,
+ *            motion  the controller motion model,
+ *            nb_sub  the future controller's default number
+ *                    of substeps.
  */
 QtCtrlSelect::QtCtrlSelect(QWidget* parent, const double tm_stp,
-			   const MotionModel& motion)
+			   const MotionModel& motion, const int nb_sub)
   : OkCancelDialog(parent, "ROS qt_ctrl Controller Selector",
 		   "Which qt_ctrl controller do you want\n"
 		   "to start, and in which ROS environment?"),
     ROS_workspace( tr("ROS workspace") ), ctrl_id(2),//-1
-    save_file( tr(default_save_name) ), time_step(tm_stp),
+    save_file( tr(default_save_name) ),
     motion_model(motion), controller(NULL), ctrl_wdgt(NULL) {
  
   int index, idx2;
@@ -67,10 +69,11 @@ QtCtrlSelect::QtCtrlSelect(QWidget* parent, const double tm_stp,
   QHBoxLayout *ROS_layout = new QHBoxLayout(ROS_line); 
   // the center part of the dialog contains several group boxes:
   // one for the ROS connection (containing a second one for the ROS
-  //  workspace), one for the controller selection and one for output
-  // file.
+  //  workspace), one for the control rate, one for the controller
+  // selection and one for output file.
   QGroupBox
     *ROS_connect = new QGroupBox(tr("Connection to ROS"), ROS_line),
+    *rate_line   = new QGroupBox(tr("Control Rate"), this),
     *ctrl_line   = new QGroupBox(tr("Controller Selection"), this),
     *output_line = new QGroupBox(tr("Output File"), this);
   
@@ -100,6 +103,23 @@ QtCtrlSelect::QtCtrlSelect(QWidget* parent, const double tm_stp,
       ROS_layouts[index]->addWidget( &(select_ROS[index][idx2]) ); 
     } } // end of for (all ROS buttons)
   insertWidget(*ROS_line); 
+  // === control rate (before the controller, which needs it) ========
+  QHBoxLayout *rate_layout = new QHBoxLayout(rate_line);
+  time_step_box.setRange(0.01, 1);
+  time_step_box.setDecimals(3);
+  time_step_box.setSingleStep(0.01);
+  time_step_box.setSuffix( tr(" s") );
+  time_step_box.setValue(tm_stp);
+  substeps_box.setRange(1, 100);
+  substeps_box.setValue(nb_sub);
+  rate_layout->addWidget( new QLabel( tr("Time step:") ) );
+  rate_layout->addWidget(&time_step_box);
+  rate_layout->addWidget( new QLabel( tr("Substeps:") ) );
+  rate_layout->addWidget(&substeps_box);
+  // a new time step needs a new controller
+  connect( &time_step_box, SIGNAL( editingFinished() ),
+	   this, SLOT( updateTimeStep() ) );
+  insertWidget(*rate_line);
   // === controller selection ========================================
    
   QHBoxLayout *ctrl_layout = new QHBoxLayout(ctrl_line);  
@@ -148,7 +168,8 @@ void QtCtrlSelect::updateCtrl(int new_id) {
   iSeeML::rob::OrPtConfig q;  // for tracking controllers
   static const int nb_coef = 6;  // for PID controllers...
   static const double h_coef = 1 / 0.35; // from [DP96]
-  const double time_coef = 1 / time_step;
+  const double time_step = time_step_box.value(),
+    time_coef = 1 / time_step;
 
 
   //modif param PID
@@ -0,0 +1,175 @@
+/**
+ * @file /src/gui/series.cpp
+ *
+ * @brief Qt graphics item drawing a long polyline, decimated
+ *        at the screen's resolution.
+ *
+ * @date October 2026
+ **/
+
+#include <math.h>                   // to get floor() declaration
+#include <algorithm>                // to get std::min() declaration
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <gui/series.hpp>
+
+
+/* The constructor sets the kind of polyline and the pen.
+ *
+ * Parameter knd  the kind of polyline,
+ *           pn   the drawing pen.
+ */
+SeriesItem::SeriesItem(const Kind knd, const QPen& pn)
+  : kind(knd), pen(pn), stride(1), nb_pending(0), path_detail(0),
+    path_size(0) {
+  points.reserve(max_points);
+} // end of SeriesItem::SeriesItem(const Kind, const QPen&) ----------
+
+/* Adds a point at the end of the polyline, decimated by the stride
+ * as the compacted ones.
+ *
+ * Parameter point  the new point.
+ */
+void SeriesItem::append(const QPointF& point) {
+  // number of added points per group (two are kept for a time series)
+  const size_t group = kind == curve ? stride : 2 * stride;
+
+  prepareGeometryChange();  // (before the bounds change)
+  // compacted between the groups, with room for a time series' pair
+  if ( (nb_pending == 0) && ( (int) points.size() >= max_points - 1 ) )
+    compact();
+  bounds = points.empty() ? QRectF(point, point)
+    : bounds.united( QRectF(point, point) );
+  if ( (nb_pending == 0)  // a new group
+       || ( (kind == timeSeries) && (nb_pending == 1) ) )
+    points.push_back(point);
+  else if (kind == curve)  // the group's last point
+    points.back() = point;
+  else {  // time series: the group's minimum and maximum
+    QPointF &first = points[points.size() - 2], &second = points.back();
+    const bool first_min = first.y() <= second.y();
+    if ( ( point.y() < std::min( first.y(), second.y() ) )
+	 || ( point.y() > std::max( first.y(), second.y() ) ) ) {
+      // the replaced extremum is dropped, the point is the last one
+      if ( (point.y() < first.y()) == first_min )
+	first = second;
+      second = point;
+    } // end of if (new extremum)
+  } // end of else (time series' group)
+  if (++nb_pending == group)  // the group is complete
+    nb_pending = 0;
+  update();
+} // end of void SeriesItem::append(const QPointF&) ------------------
+
+/* Halves the number of points: for a time series, the minimum and
+ * maximum of each four points are kept (in their order); for
+ * a curve, one point out of two is kept.  The last point is always
+ * kept.  The stride is doubled, for the next points to be as
+ * decimated, and the bounds are computed again.
+ */
+void SeriesItem::compact() {
+  const size_t nb = points.size(), step = kind == curve ? 2 : 4;
+  size_t id, nb_kept = 0;
+
+  for(id = 0; id + step < nb; id += step)
+    if (kind == curve)
+      points[nb_kept++] = points[id];
+    else {  // minimum and maximum ordinates, in their order
+      size_t min = id, max = id;
+      for(size_t other = id + 1; other < id + step; other++) {
+	if ( points[other].y() < points[min].y() )  min = other;
+	if ( points[other].y() > points[max].y() )  max = other;
+      } // end of for (each other point of the group)
+      const QPointF first = points[std::min(min, max)],
+	second = points[std::max(min, max)];
+      points[nb_kept++] = first;
+      points[nb_kept++] = second;
+    } // end of else (time series)
+  for( ; id < nb; id++)  // the last points are all kept
+    points[nb_kept++] = points[id];
+  points.resize(nb_kept);
+  stride *= 2;
+  bounds = QRectF(points[0], points[0]);
+  for(id = 1; id < nb_kept; id++)
+    bounds = bounds.united( QRectF(points[id], points[id]) );
+  path_size = 0;  // the path has to be built again
+} // end of void SeriesItem::compact() -------------------------------
+
+/* Gives the indexes of the points drawn at a given level of detail.
+ *
+ * Parameter kind    the kind of polyline,
+ *           points  the points of the polyline,
+ *           detail  the level of detail (pixels per scene unit),
+ *           kept    the indexes of the drawn points (output).
+ */
+void SeriesItem::decimate(const Kind kind,
+			  const std::vector<QPointF>& points,
+			  const qreal& detail, std::vector<size_t>& kept) {
+  const size_t nb = points.size();
+  const qreal pixel = detail > 0 ? 1 / detail : 0;  // in scene units
+  size_t id = 0;
+
+  kept.clear();
+  if (nb == 0)
+    return;
+  if (kind == curve) {  // drops the points closer than a pixel
+    kept.push_back(0);
+    for(id = 1; id + 1 < nb; id++) {
+      const QPointF diff = points[id] - points[ kept.back() ];
+      if ( (fabs( diff.x() ) >= pixel)
+	   || (fabs( diff.y() ) >= pixel) )
+	kept.push_back(id);
+    } // end of for (each inner point)
+    if (nb > 1)
+      kept.push_back(nb - 1);
+    return;
+  } // end of if (curve)
+  while (id < nb) {  // time series: one group per pixel column
+    const qreal column = floor( points[id].x() * detail );
+    size_t first = id, last = id, min = id, max = id;
+    for(id++; (id < nb)
+	  && (floor( points[id].x() * detail ) == column); id++) {
+      last = id;
+      if ( points[id].y() < points[min].y() )  min = id;
+      if ( points[id].y() > points[max].y() )  max = id;
+    } // end of for (each point of the column)
+    // first, extrema (in their order) and last, without duplicate
+    const size_t group[] = { first, std::min(min, max),
+			     std::max(min, max), last };
+    for(int index = 0; index < 4; index++)
+      if ( kept.empty() || (group[index] > kept.back()) )
+	kept.push_back(group[index]);
+  } // end of while (each pixel column)
+} // end of static void SeriesItem::decimate(const Kind, ...) --------
+
+/* Gives the bounds of the item, with a margin for the pen.
+ *
+ * Returns the bounding rectangle.
+ */
+QRectF SeriesItem::boundingRect() const {
+  return bounds.adjusted(-1, -1, 1, 1);
+} // end of QRectF SeriesItem::boundingRect() const ------------------
+
+/* Draws the decimated polyline, building its path again only if
+ * points were added or the level of detail changed.
+ *
+ * Parameter painter  the painter (giving the level of detail).
+ */
+void SeriesItem::paint(QPainter* painter,
+		       const QStyleOptionGraphicsItem*, QWidget*) {
+  const qreal detail = QStyleOptionGraphicsItem::
+    levelOfDetailFromTransform( painter->worldTransform() );
+
+  if (points.size() < 2)
+    return;
+  if ( (path_size != points.size())
+       || (fabs(detail - path_detail) > path_detail * 1E-2) ) {
+    decimate(kind, points, detail, path_kept);
+    path = QPainterPath( points[ path_kept[0] ] );
+    for(size_t id = 1; id < path_kept.size(); id++)
+      path.lineTo( points[ path_kept[id] ] );
+    path_detail = detail;  path_size = points.size();
+  } // end of if (path to build again)
+  painter->setPen(pen);
+  painter->drawPath(path);
+} // end of void SeriesItem::paint(QPainter*, ...) -------------------
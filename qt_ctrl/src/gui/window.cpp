@@ -17,9 +17,37 @@
 #include <QSettings>
 #include <QFileDialog>
 #include <QDialogButtonBox>
+#include <stdlib.h>                 // to get atof() declaration
+#include <vector>
 
 
-const double QtCtrlGUI::time_step = .2;
+/* Reads an option of the command line, either as "--name=value",
+ * "--name value" or as a ROS private parameter "_name:=value"
+ * (in a launch file's args).
+ *
+ * Parameters argc   the arguments' count,
+ *            argv   the arguments' value,
+ *            name   the option's name (without "--"),
+ *            param  the parameter's name (without "_").
+ *
+ * Returns the option's value, or NULL if not given.
+ */
+static const char* readOption(const int argc, char** argv,
+			      const char* name, const char* param) {
+  const std::string option = std::string("--") + name,
+    ros_param = std::string("_") + param + ":=";
+
+  for(int id = 1; id < argc; id++) {
+    const std::string arg = argv[id];
+    if ( (arg == option) && (id + 1 < argc) )
+      return argv[id + 1];
+    if (arg.compare(0, option.size() + 1, option + '=') == 0)
+      return argv[id] + option.size() + 1;
+    if (arg.compare(0, ros_param.size(), ros_param) == 0)
+      return argv[id] + ros_param.size();
+  } // end of for (each argument)
+  return NULL;
+} // end of static const char* readOption(const int, char**, ...) ---
 
 /* The constructor requires <tt>main()</tt>'s arguments (they can 
  *  be forwarded by the @ref ROSnode "ROS node" to ROS).
@@ -31,13 +59,24 @@ const double QtCtrlGUI::time_step = .2;
  * See ROSnode::ROSnode().
  */
 QtCtrlGUI::QtCtrlGUI(const int argc, char** argv, QWidget* parent)
-  : QMainWindow(parent),   menu_bar(this),  app_menu(&menu_bar), 
-    help_menu(&menu_bar), tool_bar(this), start_stop_action(this), 
+  : QMainWindow(parent), time_step(.2), nb_substeps(1),
+    menu_bar(this),  app_menu(&menu_bar), help_menu(&menu_bar),
+    tool_bar(this), start_stop_action(this), 
     about_action(this), about_Qt_action(this), ROS_server(this),
-    motion_model(-.5, .5, M_PI/4, -.6, .5, -M_PI/8, M_PI/8),
+    motion_model(),  // limits are given by QtCtrlLimits
     controller( new NoCtrl(motion_model) ), ctrl_node(argc, argv), 
     ctrl_wdgt( new ViewCtrlWdgt(*this, *controller, motion_model) ), 
-    display(*this), logs(this) { // setup the UI
+    display(*this), logs(this), timing_timer(this), log_timer(this),
+    telemetry_timer(this) {
+  // the control rate can be given on the command line
+  const char *time_opt = readOption(argc, argv, "time-step",
+				    "time_step"),
+    *substeps_opt = readOption(argc, argv, "substeps", "substeps");
+  if ( (time_opt != NULL) && (atof(time_opt) > 0) )
+    time_step = atof(time_opt);
+  if ( (substeps_opt != NULL) && (atoi(substeps_opt) > 0) )
+    nb_substeps = atoi(substeps_opt);
+  // setup the UI
   setWindowTitle( tr("ROS - Qt Controlers Benchmark") );
   setWindowIcon( QIcon(":/files/icon.png") );
   // set the Start, "About Qt Ctrl" and "About Qt" actions
@@ -86,9 +125,18 @@ QtCtrlGUI::QtCtrlGUI(const int argc, char** argv, QWidget* parent)
   logs.setModel(&( ctrl_node.loggingModel() ) );
   connect( &(ctrl_node), SIGNAL( loggingUpdated() ),
 	   this, SLOT( updateLogging() ) );
-  // needed after Q_DECLARE_METATYPE and before the connects
-  qRegisterMetaType<State>();
-  connectCtrl(); // connects the controller signals to the GUI methods
+  // the new messages are added to the log five times per second
+  connect( &log_timer, SIGNAL( timeout() ),
+	   &(ctrl_node), SLOT( flushLogs() ) );
+  log_timer.start(200);
+  // the loop's timing is read once per second
+  connect( &timing_timer, SIGNAL( timeout() ),
+	   this, SLOT( updateTiming() ) );
+  timing_timer.start(1000);
+  // the controller's updates are read at the display's rate
+  connect( &telemetry_timer, SIGNAL( timeout() ),
+	   this, SLOT( updateTelemetry() ) );
+  telemetry_timer.start(1000 / 60);
 
 // modif add 
 buttonStartStop();
@@ -150,6 +198,37 @@ void QtCtrlGUI::actionAbout() {
               with a Qt GUI, in order to compare them.</p>"));
 } // end of void QtCtrlGUI::actionAbout() ----------------------------
 
+/* Update the display of the state and of the commands, from
+ * the controller's updates: each one is recorded (history and output
+ * file), only the last ones are shown.
+ */
+void QtCtrlGUI::updateTelemetry() {
+  std::vector<Telemetry>& updates = telemetry_updates;
+  Telemetry update;
+  size_t id, last_state = 0, last_cmds = 0;
+  bool new_state = false, new_cmds = false;
+
+  updates.clear();
+  while ( controller->pollTelemetry(update) ) {
+    if (update.kind == Telemetry::stateUpdate)
+      { last_state = updates.size();  new_state = true; }
+    else
+      { last_cmds = updates.size();  new_cmds = true; }
+    updates.push_back(update);
+  } // end of while (new update)
+  for(id = 0; id < updates.size(); id++)  // in their order
+    if (updates[id].kind == Telemetry::stateUpdate)
+      display.updateState( updates[id].state, id == last_state );
+    else
+      display.updateCommands( updates[id].trans_vel,
+			      updates[id].rot_vel, id == last_cmds );
+  if (new_state)
+    ctrl_wdgt->updateState(updates[last_state].state);
+  if (new_cmds)
+    ctrl_wdgt->updateCommands(updates[last_cmds].trans_vel,
+			      updates[last_cmds].rot_vel);
+} // end of void QtCtrlGUI::updateTelemetry() ------------------------
+
 /// @brief Method activated by the "Start/Stop" button.
 void QtCtrlGUI::buttonStartStop() {
   bool not_connected, trying, tracking, reaching;
@@ -169,7 +248,7 @@ void QtCtrlGUI::buttonStartStop() {
     start_stop_action.setText( tr("Start Ctrl") ); 
   } else {  // ### start the control #################################
     do {
-      QtCtrlSelect dialog(this, time_step, motion_model);
+      QtCtrlSelect dialog(this, time_step, motion_model, nb_substeps);
 
       // modif ( com )
       //trying = dialog.exec() == QDialog::Accepted;
@@ -193,7 +272,9 @@ void QtCtrlGUI::buttonStartStop() {
 	ControlWidget* old_wdgt = ctrl_wdgt;
 	controller = dialog.newController();
 	ctrl_wdgt  = dialog.newCtrlWidget(); 
-	connectCtrl(); // connects controller signals to GUI methods
+	// the next selection proposes the same control rate
+	time_step   = dialog.timeStep();
+	nb_substeps = dialog.substeps();
 	hide();        // hide the window before modifying it
 	// add the new control widget to the main window
 	QGridLayout *central_layout =
@@ -8,7 +8,11 @@
 
 #include <ros/ros.h>
 #include <geometry_msgs/Twist.h>  // Publication format
+#include <ostream>
 #include <sstream>
+#include <chrono>
+#include <thread>
+#include <stdlib.h>                 // to get labs() declaration
 #include <model/ROS_node.hpp> 
 
 
@@ -17,11 +21,27 @@
 void ROSnode::end() {
   if ( connected() ) {
     motion_ctrl->stopMotion();
+    if (odom_spinner != NULL) {  // no more odometry
+      odom_spinner->stop();
+      delete odom_spinner;
+      odom_spinner = NULL;
+    }
     if ( ros::isStarted() ) {
       ros::shutdown();         // stops ROS, and thus the run() method
       ros::waitForShutdown();  // waits for ROS to stop
     }
     wait();  // waits for the run() method (other thread) to stop
+    recorder.close();  // once the last records are written
+    if (recorder.dropped() > 0) {  // the writing thread was late
+      std::ostringstream dropped;
+      dropped << recorder.dropped() << " records dropped";
+      log(Warn, dropped.str());
+    } // end of if (dropped records)
+    delete estimator;
+    estimator = NULL;
+    // the log is not written any more by the main loop
+    log( Info, "Loop timing:\n" + timing.summary() );
+    flushLogs();
     motion_ctrl = NULL;
   } // end of if (connected)
 } // end of ROSnode::~ROSnode() --------------------------------------
@@ -34,21 +54,51 @@ void ROSnode::end() {
 void ROSnode::ROSsetup(Controller& ctrl) {
   if ( ros::master::check() ) {
     motion_ctrl = &ctrl;
-    ros::NodeHandle nh;
+    ros::NodeHandle nh, private_nh("~");
     // explicitly needed since our nodehandle is going out of scope
     ros::start();
+    // the real-time mode of the main loop is optional
+    private_nh.param("realtime", rt_options.enabled, false);
+    private_nh.param("rt_cpu", rt_options.cpu, -1);
+    private_nh.param("rt_priority", rt_options.priority, 80);
+    // so is the event-driven mode, at most 4 cycles per time step
+    private_nh.param("event_driven", event_driven, false);
+    private_nh.param("min_period", min_period, ctrl.timeStep() / 4);
+    // states and commands can be recorded, to be replayed offline
+    std::string record_file;
+    if ( private_nh.getParam("record", record_file) ) {
+      if ( !recorder.open( record_file.c_str(), ctrl.timeStep() ) )
+	log( Warn, "Cannot record into " + record_file );
+      else {  // the goal of a reaching controller, for the replay
+	const ReachingCtrl *reach_ctrl
+	  = dynamic_cast<const ReachingCtrl*>(&ctrl);
+	if (reach_ctrl != NULL)
+	  recorder.goal( reach_ctrl->getGoal() );
+      } // end of else (recording)
+    } // end of if (record file)
+    // the odometry can be filtered and predicted
+    std::string estimator_name;
+    private_nh.param("estimator", estimator_name, std::string("none"));
+    delete estimator;
+    estimator = estimator_name == "ekf" ? new UnicycleEKF() : NULL;
     // set the publisher used to send the commands (velocities)
     cmd_publisher = nh.advertise<geometry_msgs::Twist>
       ("cmd_vel_mux/input/teleop", 10);
-    // subscrive to the odometry topic, 
-    // and start new_odom method with each new data
-    odom_subscriber = nh.subscribe("/odom", 1000,
-				   &ROSnode::newOdometry, this);
+    // subscrive to the odometry topic, and start new_odom method
+    // with each new data, in its own queue and thread: only the last
+    // data matter, the older ones are dropped
+    ros::NodeHandle odom_nh;
+    odom_nh.setCallbackQueue(&odom_queue);
+    odom_subscriber = odom_nh.subscribe
+      ( "/odom", 1, &ROSnode::newOdometry, this,
+	ros::TransportHints().tcpNoDelay() );
+    odom_spinner = new ros::AsyncSpinner(1, &odom_queue);
+    odom_spinner->start();
     start();  // starts the process, and calls run()
   } // end of if (is_connected)
 } // end of void ROSnode::ROSsetup() ---------------------------------
 
-// Sends the odometry data to the controller.
+// Gives the odometry data to the main loop (odometry's thread).
 // Parameter: odom  the new odometry data.
 // See Controller::newState().
 void ROSnode::newOdometry(const nav_msgs::Odometry::ConstPtr& odom) {
@@ -63,11 +113,16 @@ void ROSnode::newOdometry(const nav_msgs::Odometry::ConstPtr& odom) {
   const geometry_msgs::Twist& twist = odom->twist.twist; 
   double roll, pitch, yaw;
   tfMatrix.getRPY(roll, pitch, yaw);
-  const State
-    state(date - initial_date,
-	  iSeeML::rob::OrPtConfig(iSeeML::geom::Point(point.x, point.y),
-				  yaw), twist.linear.x, twist.angular.z);
-  motion_ctrl->newState(state); 
+  const StampedState stamped =
+    { State(date - initial_date,
+	    iSeeML::rob::OrPtConfig(iSeeML::geom::Point(point.x, point.y),
+				    yaw), twist.linear.x, twist.angular.z),
+      t };
+  odom_state.write(stamped);  // sent by the main loop
+  if (event_driven) {  // which is waiting for it
+    QMutexLocker locker(&odom_mutex);
+    odom_arrived.wakeAll();
+  }
 } // end of void ROSnode::newOdometry(const nav_msgs:...:ConstPtr&) --
 
 /* Main loop of the process (in a separate thread).
@@ -79,24 +134,112 @@ void ROSnode::newOdometry(const nav_msgs::Odometry::ConstPtr& odom) {
 void ROSnode::run() {  
   if ( connected() ) {
     const double loop_frequ = 1 / motion_ctrl->timeStep();
+    if (rt_options.enabled)  // this thread becomes a real-time one
+      log( Info, "Real-time mode: " + rt_options.setup() );
     // defined from input stream, if any
     ros::Rate loop_rate(loop_frequ);
+    // in real-time mode, absolute deadlines of the monotonic clock
+    DeadlineTimer deadlines( motion_ctrl->timeStep() );
     geometry_msgs::Twist vel;
+    StampedState odom;
+    State ctrl_state;  // state given to the controller
+    // the controller's log is written without allocation
+    LogBuffer log_buffer;
+    std::ostream log_msg(&log_buffer);
+    // timing of the loop (monotonic clock, microseconds)
+    typedef std::chrono::steady_clock Clock;
+    const long period = 1E6 * motion_ctrl->timeStep();
+    Clock::time_point cycle_start, last_start;
+    bool first_cycle = true;
+    // in event-driven mode, the cycles' minimum duration, and the
+    // watchdog's one (a time step)
+    const Clock::duration min_gap = std::chrono::microseconds
+      ( (long)(1E6 * min_period) ), watchdog
+      = std::chrono::microseconds(period);
   
     motion_ctrl->stopMotion();  // Sets the velocities to zero.
+    if (event_driven)
+      log( Info, "Event-driven mode" );
     while ( ros::ok() ) {
-      std::ostringstream log_msg;
+      if (event_driven && !first_cycle) {
+	// not before the minimum duration, even if data are waiting
+	std::this_thread::sleep_until(last_start + min_gap);
+	if ( !waitOdometry(last_start + watchdog) )
+	  timing.timeouts.fetch_add(1, std::memory_order_relaxed);
+      } // end of if (event-driven)
+      log_buffer.clear();
+      cycle_start = Clock::now();
+      if (!first_cycle) {  // cycle's duration
+	const long duration = std::chrono::duration_cast
+	  <std::chrono::microseconds>(cycle_start - last_start).count();
+	if (event_driven)  // the controller uses the elapsed time
+	  motion_ctrl->setCycleTime(duration * 1E-6);
+	else  // jitter
+	  timing.jitter.record( labs(duration - period) );
+      } // end of if (not first cycle)
+      last_start = cycle_start;  first_cycle = false;
+      // the last odometry data (if new), read without waiting
+      bool new_state = odom_state.read(odom);
+      ctrl_state = odom.state;
+      if (estimator != NULL) {  // fused, and predicted to now
+	if (new_state)
+	  estimator->correct(odom.state);
+	new_state = estimator->initialized();
+	if (new_state)
+	  ctrl_state = estimator->predict
+	    ( odom.state.date() + (ros::Time::now() - odom.stamp)
+	      .toSec() );
+      } // end of if (estimator)
+      if (new_state) {
+	motion_ctrl->newState(ctrl_state);
+	if ( recorder.isOpen() )  // pushed, written by its own thread
+	  recorder.state(ctrl_state);
+      } // end of if (new state)
+      if ( !odom.stamp.isZero() )  // age of the odometry's data
+	timing.odom_age.record( (ros::Time::now() - odom.stamp)
+				.toNSec() / 1000 );
       motion_ctrl->chooseVelocities(vel.linear.x, vel.angular.z,
 				    log_msg);
-      log( Info, log_msg.str() ); 
+      if ( recorder.isOpen() )
+	recorder.command(motion_ctrl->cycleTime(), vel.linear.x,
+			 vel.angular.z);
+      timing.compute.record( std::chrono::duration_cast
+			     <std::chrono::microseconds>
+			     (Clock::now() - cycle_start).count() );
+      if ( !log_buffer.empty() )
+	log( Info, log_buffer.str() );
       cmd_publisher.publish(vel);  // publish the commands
-      // spin ROS once, and wait for next time step
+      // spin ROS once, and wait for next time step (or data)
       ros::spinOnce();
-      loop_rate.sleep();
+      if ( !event_driven && !(rt_options.enabled ? deadlines.sleep()
+			      : loop_rate.sleep()) )  // deadline missed
+	timing.overruns.fetch_add(1, std::memory_order_relaxed);
     } // end of while (ROS OK)
   } // end of if (connected)
 } // end of void ROSnode::run() --------------------------------------
 
+/* Waits for new odometry data (in the event-driven main loop).
+ *
+ * Parameter deadline  the date when the waiting stops anyway.
+ *
+ * Returns whether new data arrived before the deadline.
+ */
+bool ROSnode::waitOdometry
+(const std::chrono::steady_clock::time_point& deadline) {
+  QMutexLocker locker(&odom_mutex);
+
+  while ( !odom_state.written() && ros::ok() ) {
+    // remaining time, rounded up to the next millisecond
+    const long remain = ( std::chrono::duration_cast
+			  <std::chrono::microseconds>
+			  (deadline - std::chrono::steady_clock::now())
+			  .count() + 999 ) / 1000;
+    if ( (remain <= 0) || !odom_arrived.wait(&odom_mutex, remain) )
+      break;  // watchdog
+  } // end of while (no data)
+  return odom_state.written();
+} // end of bool ROSnode::waitOdometry(const ...::time_point&) -------
+
 /* Connects to ROS server with parameters.
  *
  * Parameters: master_url  the URI of the ROS master,
@@ -114,31 +257,55 @@ void ROSnode::init(const std::string &master_url,
   ROSsetup(ctrl);
 } // end of void ROSnode::init(const std::string&, ..., Controller&) -
 
-/* Writes a message at given level in the log.
+/* Writes a message at given level in the log, added to ROS log and
+ * to the GUI log by the next call to flushLogs().
  *
  * Parameters: level  the log's severity level,
  *             msg    the message.
  *
- * See ROS::console, ROS::Time, QStringListModel,
- *     connected(), loggingModel(), loggingUpdated(). 
+ * See ROS::Time, connected(), flushLogs(). 
+ */
+void ROSnode::log(const LogLevel &level, const char* msg) {
+  if ( connected() && (level < Count) && (msg[0] != '\0') )
+    // both logs are filled later, by the GUI's thread: ROS log
+    // formats, allocates and locks its appenders
+    log_ring.push( (int)(level), ros::Time::now().toSec(), msg );
+} // end of void ROSnode::log(const LogLevel&, const char*) ----------
+
+/* Adds the messages written since the last call to ROS log and to
+ * the GUI log, and removes the oldest rows of the latter if needed.
+ *
+ * See ROS::console, QStringListModel,
+ *     log(const LogLevel&, const char*), loggingUpdated(). 
  */
-void ROSnode::log(const LogLevel &level, const std::string &msg) {
+void ROSnode::flushLogs() {
   static const char* levelName[Count] =
     {"DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
-  std::stringstream log_model_msg;
+  const unsigned long dropped = log_ring.dropped();
+  QStringList rows;
+  LogRing::Entry entry;
 
-  if ( connected() && (level < Count) && ( !msg.empty() ) ) {
+  while ( log_ring.pop(entry) ) {  // write the formated messages
     // fills ROS log at the requested level
-    ROS_LOG_STREAM(level, ROSCONSOLE_DEFAULT_NAME, msg);
-    // change the GUI log: insert a line in the GUI log
-    log_model.insertRows(log_model.rowCount(),1);
-    // write the formated (add level and date) message 
-    log_model_msg << "[" << levelName[(int)(level)] << "] ["
-		  << ros::Time::now() << "]: " << msg;
-    // transform the string stream into a QVariant (= union)
-    QVariant new_row( QString( log_model_msg.str().c_str() ) );
-    // add it as the last line of the log
-    log_model.setData(log_model.index(log_model.rowCount()-1), new_row);
+    ROS_LOG( (LogLevel)(entry.level), ROSCONSOLE_DEFAULT_NAME, "%s",
+	     entry.text );
+    rows << QString("[%1] [%2]: %3").arg(levelName[entry.level])
+      .arg(entry.date, 0, 'f', 6).arg(entry.text);
+  } // end of while (message popped)
+  if (dropped != log_dropped) {  // signal the lost messages
+    rows << QString("[WARN] %1 messages dropped (full log ring)")
+      .arg(dropped - log_dropped);
+    log_dropped = dropped;
+  } // end of if (dropped messages)
+  if ( !rows.empty() ) {
+    // insert the new lines at once in the GUI log
+    const int first = log_model.rowCount();
+    log_model.insertRows( first, rows.size() );
+    for(int id = 0; id < rows.size(); id++)
+      log_model.setData( log_model.index(first + id), rows[id] );
+    // and only keep the last ones
+    if (log_model.rowCount() > max_log_rows)
+      log_model.removeRows(0, log_model.rowCount() - max_log_rows);
     Q_EMIT loggingUpdated(); // ask the GUI to show its log
-  } // end of if (connected, valid level & message non empty)
-} // end of void ROSnode::log(const LogLevel&, const std::string &) --
+  } // end of if (new rows)
+} // end of void ROSnode::flushLogs() --------------------------------
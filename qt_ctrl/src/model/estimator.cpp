@@ -0,0 +1,160 @@
+/**
+ * @file  src/model/estimator.cpp
+ *
+ * @brief Online estimation of the robot's state from odometry.
+ *
+ * @date  October 2026
+ **/
+
+#include <math.h>                   // to get cos() declaration
+#include <algorithm>                // to get std::max() declaration
+#include <model/estimator.hpp>
+
+
+/* Propagates the estimate and its covariance, velocities being
+ * constant up to a white noise of acceleration.
+ *
+ * Parameter dt  the duration of the propagation.
+ */
+void UnicycleEKF::propagate(const double& dt) {
+  const double v = estimate[3], w = estimate[4],
+    // mean orientation during the step
+    phi = estimate[2] + w * dt / 2, c = cos(phi), s = sin(phi);
+  double jacob[size][size], noise_gain[size][2], tmp[size][size];
+  int i, j, k;
+
+  // the Jacobian of the motion, at the current estimate
+  for(i = 0; i < size; i++)
+    for(j = 0; j < size; j++)
+      jacob[i][j] = (i == j);
+  jacob[0][2] = - v * dt * s;  jacob[0][3] = dt * c;
+  jacob[0][4] = - v * dt * dt * s / 2;
+  jacob[1][2] =   v * dt * c;  jacob[1][3] = dt * s;
+  jacob[1][4] =   v * dt * dt * c / 2;
+  jacob[2][4] = dt;
+  // the effect of the accelerations' noise
+  noise_gain[0][0] = dt * dt * c / 2;  noise_gain[0][1] = 0;
+  noise_gain[1][0] = dt * dt * s / 2;  noise_gain[1][1] = 0;
+  noise_gain[2][0] = 0;  noise_gain[2][1] = dt * dt / 2;
+  noise_gain[3][0] = dt; noise_gain[3][1] = 0;
+  noise_gain[4][0] = 0;  noise_gain[4][1] = dt;
+  // the estimate moves (midpoint rule)
+  estimate[0] += v * dt * c;
+  estimate[1] += v * dt * s;
+  estimate[2] = iSeeML::Object::mod2pi(estimate[2] + w * dt);
+  // covariance = jacob . covariance . jacob^T + G . Q . G^T
+  for(i = 0; i < size; i++)
+    for(j = 0; j < size; j++) {
+      tmp[i][j] = 0;
+      for(k = 0; k < size; k++)
+	tmp[i][j] += jacob[i][k] * covariance[k][j];
+    } // end of for (each coefficient of jacob . covariance)
+  for(i = 0; i < size; i++)
+    for(j = 0; j < size; j++) {
+      double sum = noise_gain[i][0] * noise_gain[j][0]
+	* noise.trans_acc * noise.trans_acc + noise_gain[i][1]
+	* noise_gain[j][1] * noise.rot_acc * noise.rot_acc;
+      for(k = 0; k < size; k++)
+	sum += tmp[i][k] * jacob[j][k];
+      covariance[i][j] = sum;
+    } // end of for (each coefficient of the covariance)
+} // end of void UnicycleEKF::propagate(const double&) ---------------
+
+/* Fuses a new measure into the estimate.
+ *
+ * Parameter measure  the measured state, with its date.
+ */
+void UnicycleEKF::correct(const State& measure) {
+  const iSeeML::rob::OrPtConfig& q = measure.configuration();
+  const double values[size] =
+    { q.position().xCoord(), q.position().yCoord(), q.orientation(),
+      measure.translationVelocity(), measure.rotationVelocity() },
+    deviations[size] =
+    { noise.position, noise.position, noise.angle, noise.trans_vel,
+      noise.rot_vel };
+  double innov_cov[size][size], gain[size][size], innov[size];
+  int i, j, k;
+
+  if (!has_estimate) {  // the first measure gives the estimate
+    for(i = 0; i < size; i++) {
+      estimate[i] = values[i];
+      for(j = 0; j < size; j++)
+	covariance[i][j] = (i == j) * deviations[i] * deviations[i];
+    } // end of for (each coefficient)
+    date = measure.date();  has_estimate = true;
+    return;
+  } // end of if (first measure)
+  if (measure.date() > date)  // (an older measure is fused at once)
+    propagate(measure.date() - date);
+  date = std::max(date, measure.date());
+  // the whole state is measured: the innovation's covariance
+  // is the estimate's one plus the measure's one
+  for(i = 0; i < size; i++) {
+    innov[i] = values[i] - estimate[i];
+    for(j = 0; j < size; j++)
+      innov_cov[i][j] = covariance[i][j]
+	+ (i == j) * deviations[i] * deviations[i];
+  } // end of for (each coefficient)
+  innov[2] = iSeeML::Object::mod2pi(innov[2]);
+  // Cholesky decomposition of the innovation's covariance (in place,
+  // lower part): it is symmetric positive definite
+  for(j = 0; j < size; j++) {
+    for(k = 0; k < j; k++)
+      innov_cov[j][j] -= innov_cov[j][k] * innov_cov[j][k];
+    innov_cov[j][j] = sqrt(innov_cov[j][j]);
+    for(i = j + 1; i < size; i++) {
+      for(k = 0; k < j; k++)
+	innov_cov[i][j] -= innov_cov[i][k] * innov_cov[j][k];
+      innov_cov[i][j] /= innov_cov[j][j];
+    } // end of for (each line below the diagonal)
+  } // end of for (each column)
+  // gain = covariance . innov_cov^-1: each line of the gain solves
+  // L . L^T . line^T = covariance's line (symmetric covariance)
+  for(i = 0; i < size; i++) {
+    double line[size];
+    for(j = 0; j < size; j++) {  // forward substitution
+      line[j] = covariance[i][j];
+      for(k = 0; k < j; k++)
+	line[j] -= innov_cov[j][k] * line[k];
+      line[j] /= innov_cov[j][j];
+    } // end of for (forward substitution)
+    for(j = size - 1; j >= 0; j--) {  // backward substitution
+      for(k = j + 1; k < size; k++)
+	line[j] -= innov_cov[k][j] * line[k];
+      line[j] /= innov_cov[j][j];
+    } // end of for (backward substitution)
+    for(j = 0; j < size; j++)
+      gain[i][j] = line[j];
+  } // end of for (each line of the gain)
+  // estimate += gain . innov,  covariance = (I - gain) . covariance
+  double new_cov[size][size];
+  for(i = 0; i < size; i++) {
+    for(k = 0; k < size; k++)
+      estimate[i] += gain[i][k] * innov[k];
+    for(j = 0; j < size; j++) {
+      new_cov[i][j] = covariance[i][j];
+      for(k = 0; k < size; k++)
+	new_cov[i][j] -= gain[i][k] * covariance[k][j];
+    } // end of for (each column)
+  } // end of for (each line)
+  estimate[2] = iSeeML::Object::mod2pi(estimate[2]);
+  for(i = 0; i < size; i++)  // kept symmetric
+    for(j = 0; j < size; j++)
+      covariance[i][j] = (new_cov[i][j] + new_cov[j][i]) / 2;
+} // end of void UnicycleEKF::correct(const State&) ------------------
+
+/* Gives the estimated state at a given date.
+ *
+ * Parameter when  the date.
+ *
+ * Returns the estimated state at this date.
+ */
+State UnicycleEKF::predict(const double& when) const {
+  const double duration = when - date, v = estimate[3],
+    w = estimate[4], phi = estimate[2] + w * duration / 2;
+
+  return State( when, iSeeML::rob::OrPtConfig
+		( estimate[0] + v * duration * cos(phi),
+		  estimate[1] + v * duration * sin(phi),
+		  estimate[2] + w * duration ), v, w );
+} // end of State UnicycleEKF::predict(const double&) const ----------
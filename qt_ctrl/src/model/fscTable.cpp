@@ -0,0 +1,107 @@
+/**
+ * @file  src/model/fscTable.cpp
+ *
+ * @brief Table of the lengths of FSC paths.
+ *
+ * @date  October 2026
+ **/
+
+#include <map>
+#include <algorithm>
+#include <math.h>                   // to get floor() declaration
+#include <QMutex>
+#include <model/planner.hpp>
+#include <model/fscTable.hpp>
+#include <model/fscValues.hpp>
+
+
+/* The constructor plans the lengths of the grid.
+ *
+ * Parameter max_curv   the maximum curvature of the paths,
+ *           max_deriv  the maximum curvature's derivative,
+ *           rng        the half size of the square of positions,
+ *           nb_p       the number of positions along a side,
+ *           nb_o       the number of orientations.
+ */
+FscLengthTable::FscLengthTable(const double& max_curv,
+			       const double& max_deriv,
+			       const double& rng, const int nb_p,
+			       const int nb_o)
+  : range(rng), nb_pos(nb_p < 2 ? 2 : nb_p),
+    nb_orient(nb_o < 1 ? 1 : nb_o) {
+  const int nb = nb_pos * nb_pos * nb_orient;
+  const double step = 2 * range / (nb_pos - 1);
+  const iSeeML::rob::FscPath model =
+    FscValues::path(iSeeML::rob::OrPtConfig(), max_curv, max_deriv);
+  std::vector<iSeeML::rob::OrPtConfig> starts(nb), goals;
+  std::vector<double> lens(nb);
+  int i, j, k;
+
+  goals.reserve(nb);
+  for(k = 0; k < nb_orient; k++)
+    for(j = 0; j < nb_pos; j++)
+      for(i = 0; i < nb_pos; i++)
+	goals.push_back( iSeeML::rob::OrPtConfig
+			 (i * step - range, j * step - range,
+			  k * 2 * M_PI / nb_orient - M_PI) );
+  BatchPlanner::plan(model, &starts[0], &goals[0], nb, &lens[0]);
+  lengths.assign( lens.begin(), lens.end() );
+} // end of FscLengthTable::FscLengthTable(const double&, ...) -------
+
+/* Gives an estimation of the length of the FSC path connecting two
+ * configurations, by a trilinear interpolation.
+ *
+ * Parameter start  the starting configuration,
+ *           goal   the goal configuration.
+ *
+ * Returns the interpolated length, or a negative value if the goal
+ * is out of the table's square.
+ */
+double FscLengthTable::length(const iSeeML::rob::OrPtConfig& start,
+			      const iSeeML::rob::OrPtConfig& goal) const {
+  const iSeeML::rob::OrPtConfig rel = start.projection(goal);
+  const double step = 2 * range / (nb_pos - 1),
+    u = (rel.position().xCoord() + range) / step,
+    v = (rel.position().yCoord() + range) / step,
+    w = ( iSeeML::Object::mod2pi(rel.orientation()) + M_PI )
+    * nb_orient / (2 * M_PI);
+  if ( (u < 0) || (v < 0) || (u > nb_pos - 1) || (v > nb_pos - 1) )
+    return -1;
+  // indexes of the cell (the last one if on the border)
+  const int i = std::min( (int) floor(u), nb_pos - 2 ),
+    j = std::min( (int) floor(v), nb_pos - 2 ),
+    k = (int) floor(w) % nb_orient, k1 = (k + 1) % nb_orient;
+  const double a = u - i, b = v - j, c = w - floor(w);
+  const float *l0 = &lengths[ (k * nb_pos + j) * nb_pos + i ],
+    *l1 = &lengths[ (k1 * nb_pos + j) * nb_pos + i ];
+  // bilinear interpolations, in both orientations
+  const double len0 = (1 - b) * ( (1 - a) * l0[0] + a * l0[1] )
+    + b * ( (1 - a) * l0[nb_pos] + a * l0[nb_pos + 1] ),
+    len1 = (1 - b) * ( (1 - a) * l1[0] + a * l1[1] )
+    + b * ( (1 - a) * l1[nb_pos] + a * l1[nb_pos + 1] );
+  return (1 - c) * len0 + c * len1;
+} // end of double FscLengthTable::length(const ...&, ...) const -----
+
+/* Gives the table of the given parameters, shared by all its users.
+ *
+ * Parameter max_curv   the maximum curvature of the paths,
+ *           max_deriv  the maximum curvature's derivative.
+ *
+ * Returns the table of the given parameters.
+ */
+std::shared_ptr<const FscLengthTable>
+FscLengthTable::shared(const double& max_curv, const double& max_deriv) {
+  static const double nb_radii = 8;
+  static QMutex mutex;
+  static std::map< std::pair<double, double>,
+		   std::shared_ptr<const FscLengthTable> > tables;
+  QMutexLocker locker(&mutex);
+  std::shared_ptr<const FscLengthTable>& table =
+    tables[ std::make_pair( fabs(max_curv), fabs(max_deriv) ) ];
+
+  if (!table)  // first call for these parameters
+    table.reset( new FscLengthTable
+		 ( max_curv, max_deriv, nb_radii
+		   * FscValues::get(max_curv, max_deriv).turn_rad ) );
+  return table;
+} // end of std::shared_ptr<...> FscLengthTable::shared(...) ---------
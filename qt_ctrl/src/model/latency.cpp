@@ -0,0 +1,60 @@
+/**
+ * @file  src/model/latency.cpp
+ *
+ * @brief Histograms of the control loop's timing.
+ *
+ * @date  October 2026
+ **/
+
+#include <sstream>
+#include <iomanip>
+#include <model/latency.hpp>
+
+
+/* Gives a percentile of the recorded durations.
+ *
+ * Parameter percent  the percentage of durations below the result.
+ *
+ * Returns the highest duration (in µs) of the bucket where this
+ * percentage is reached, never more than the maximum.
+ */
+long LatencyHistogram::percentile(const double& percent) const {
+  const unsigned long nb = count();
+  // the rank of the duration (at least the first one)
+  const double rank = percent < 0 ? 0 : percent > 100 ? nb
+    : nb * percent / 100;
+  unsigned long nb_below = 0;
+  int id;
+
+  if (nb == 0)
+    return 0;
+  for(id = 0; id < nbBuckets - 1; id++) {
+    nb_below += counts[id].load(std::memory_order_relaxed);
+    if ( (nb_below > 0) && (nb_below >= rank) )
+      break;
+  } // end of for (each bucket)
+  const long value = highest(id), max = maximum();
+  return value < max ? value : max;
+} // end of long LatencyHistogram::percentile(const double&) const ---
+
+/* Gives a summary of the histograms, one line by histogram.
+ *
+ * Returns their median, 99th percentile and maximum, in milliseconds.
+ */
+std::string LoopTiming::summary() const {
+  static const char* names[] = {"odometry age", "compute", "jitter"};
+  const LatencyHistogram* histograms[] = {&odom_age, &compute, &jitter};
+  std::ostringstream out;
+
+  out << std::fixed << std::setprecision(3);
+  for(int id = 0; id < 3; id++) {
+    const LatencyHistogram& histo = *histograms[id];
+    out << names[id] << " (ms): 50% " << histo.percentile(50) * 1E-3
+	<< ", 99% " << histo.percentile(99) * 1E-3 << ", max "
+	<< histo.maximum() * 1E-3 << '\n';
+  } // end of for (each histogram)
+  out << "overruns: " << overruns.load(std::memory_order_relaxed)
+      << " / " << compute.count() << " cycles, watchdog: "
+      << timeouts.load(std::memory_order_relaxed);
+  return out.str();
+} // end of std::string LoopTiming::summary() const ------------------
@@ -7,6 +7,7 @@
  **/
 
 #include <math.h>                   // to get fabs() declaration
+#include <algorithm>                // to get std::min() declaration
 #include <model/motion.hpp>
 
 
@@ -76,22 +77,18 @@ double MotionModel::limAcc(const double& lim_dist, const double& dist,
 void MotionModel::applyAccelerationFactors
 (double& trans_vel, double& rot_vel, const double& trans_fact,
  const double& rot_fact, const double& time_step) const {
-  static const int nbVal = 2; // two velocities:
-  //  similar computations, using a for(){} with arrays
-  static const double min_vel[nbVal] = {limits[vMin], -limits[omMax]},
-    max_vel[nbVal] = {limits[vMax], limits[omMax]},
-    acc[nbVal]     = {limits[aMax], limits[gmMax]},
-    dec[nbVal]     = {limits[aMin], limits[gmMin]};
-  const double fact[nbVal] = {trans_fact, rot_fact}; 
-  double *vel[nbVal] = {&trans_vel, &rot_vel};
+  // two velocities: similar computations, using a for(){} with 
+  // arrays (limits are precomputed by set())
+  const double fact[nbVels] = {trans_fact, rot_fact}; 
+  double *vel[nbVels] = {&trans_vel, &rot_vel};
     
-  for(int id = 0; id < nbVal; id++) {
+  for(int id = 0; id < nbVels; id++) {
     double delta_t = time_step; 
     do { // two passes may be needed (if deccelerating)
       // is acceleration or deceleration applied?
       const bool isAcc = (*vel[id] * fact[id] >= 0);
       const double& delta_a
-	= fact[id] * ( isAcc ? acc[id] : fabs(dec[id]) );
+	= fact[id] * ( isAcc ? max_acc[id] : max_dec[id] );
       *vel[id] += delta_a * delta_t;
       delta_t = 0;  // remaining time
       if (isAcc) // acceleration: is max/min velocity respected?
@@ -102,7 +99,7 @@ void MotionModel::applyAccelerationFactors
 	}
       else // deceleration: did velocity change of sign?
 	if (*vel[id] * fact[id] > 0) { // it did! Second pass needed!
-	  *vel[id] -= delta_a * delta_t;  // restore velocity
+	  *vel[id] -= delta_a * time_step;  // restore velocity
 	  // remaining time after change of sign (vel[id] / acc < 0)
 	  delta_t = time_step + *vel[id] / delta_a; // delta_t > 0
 	  *vel[id] = 0; 
@@ -128,16 +125,12 @@ void MotionModel::applyAccelerationFactors
 void MotionModel::applyAccelerations
 (double& trans_vel, double& rot_vel, const double& trans_acc,
  const double& rot_acc, const double& time_step) const {
-  static const int nbVal = 2; // two velocities:
-  //  similar computations, using a for(){} with arrays
-  static const double min_vel[nbVal] = {limits[vMin], -limits[omMax]},
-    max_vel[nbVal] = {limits[vMax], limits[omMax]},
-    max_acc[nbVal] = {limits[aMax], limits[gmMax]},
-    max_dec[nbVal] = {limits[aMin], limits[gmMin]};
-  const double acc[nbVal] = {trans_acc, rot_acc}; 
-  double *vel[nbVal] = {&trans_vel, &rot_vel};
+  // two velocities: similar computations, using a for(){} with 
+  // arrays (limits are precomputed by set())
+  const double acc[nbVels] = {trans_acc, rot_acc}; 
+  double *vel[nbVels] = {&trans_vel, &rot_vel};
     
-  for(int id = 0; id < nbVal; id++) {
+  for(int id = 0; id < nbVels; id++) {
     double delta_t = time_step; 
     do { // two passes may be needed (if decelerating)
       // is acceleration or deceleration applied?
@@ -146,7 +139,7 @@ void MotionModel::applyAccelerations
 	sgnAcc = (acc[id] < 0 ? -1 : 1), absAcc = sgnAcc * acc[id], 
 	&delta_a = sgnAcc *
 	( isAcc ? (absAcc > max_acc[id] ? max_acc[id] : absAcc)
-	  : (absAcc > - max_dec[id] ? - max_dec[id] : absAcc) );
+	  : (absAcc > max_dec[id] ? max_dec[id] : absAcc) );
       *vel[id] += delta_a * delta_t;
       delta_t = 0;  // remaining time
       if (isAcc) // acceleration: is max/min velocity respected?
@@ -157,7 +150,7 @@ void MotionModel::applyAccelerations
 	}
       else // deceleration: did velocity change of sign?
 	if (*vel[id] * sgnAcc > 0) { // it did! Second pass needed!
-	  *vel[id] -= delta_a * delta_t;  // restore velocity
+	  *vel[id] -= delta_a * time_step;  // restore velocity
 	  // remaining time after change of sign (vel[id] / acc < 0)
 	  delta_t = time_step + *vel[id] / delta_a; // delta_t > 0
 	  *vel[id] = 0; 
@@ -165,3 +158,70 @@ void MotionModel::applyAccelerations
     } while (delta_t > 0);
   } // end of for (each velocity)
 } // end of void MotionModel::applyAccelerations(...) ----------------
+
+/* Batch version of the one robot applyAccelerationFactors method, 
+ * for arrays of robots: the same limits are applied to each robot, 
+ * without branches (only selections), so that the loop can be 
+ * vectorized.
+ *
+ * Parameter trans_vel   the translation velocities, to update,
+ *           rot_vel     the  rotation   velocities, to update,
+ *           trans_fact  the translation factors,
+ *           rot_fact    the  rotation   factors,
+ *           nb          the number of robots (size of the arrays),
+ *           time_step   the duration of the accelerations.
+ */
+void MotionModel::applyAccelerationFactors
+(double* trans_vel, double* rot_vel, const double* trans_fact,
+ const double* rot_fact, const int nb, const double& time_step) const {
+  const double ts = time_step,  // local copies of the limits
+    min_v = min_vel[transl], max_v = max_vel[transl],
+    min_om = min_vel[rot], max_om = max_vel[rot],
+    max_a = max_acc[transl], max_d = max_dec[transl],
+    max_gm = max_acc[rot], max_gd = max_dec[rot];
+
+  for(int id = 0; id < nb; id++) {
+    const double t_sgn = (trans_fact[id] < 0 ? -1 : 1),
+      t_fact = t_sgn * trans_fact[id],
+      r_sgn = (rot_fact[id] < 0 ? -1 : 1), r_fact = r_sgn * rot_fact[id];
+    trans_vel[id] = limitedVelocity(trans_vel[id], t_sgn, t_fact * max_a,
+				    t_fact * max_d, min_v, max_v, ts);
+    rot_vel[id] = limitedVelocity(rot_vel[id], r_sgn, r_fact * max_gm,
+				  r_fact * max_gd, min_om, max_om, ts);
+  } // end of for (each robot)
+} // end of void MotionModel::applyAccelerationFactors(double*, ...) -
+
+/* Batch version of the one robot applyAccelerations method, 
+ * for arrays of robots: the same limits are applied to each robot, 
+ * without branches (only selections), so that the loop can be 
+ * vectorized.
+ *
+ * Parameter trans_vel   the translation velocities, to update,
+ *           rot_vel     the  rotation   velocities, to update,
+ *           trans_acc   the translation accelerations,
+ *           rot_acc     the  rotation   accelerations,
+ *           nb          the number of robots (size of the arrays),
+ *           time_step   the duration of the accelerations.
+ */
+void MotionModel::applyAccelerations
+(double* trans_vel, double* rot_vel, const double* trans_acc,
+ const double* rot_acc, const int nb, const double& time_step) const {
+  const double ts = time_step,  // local copies of the limits
+    min_v = min_vel[transl], max_v = max_vel[transl],
+    min_om = min_vel[rot], max_om = max_vel[rot],
+    max_a = max_acc[transl], max_d = max_dec[transl],
+    max_gm = max_acc[rot], max_gd = max_dec[rot];
+
+  for(int id = 0; id < nb; id++) {
+    const double t_sgn = (trans_acc[id] < 0 ? -1 : 1),
+      t_acc = t_sgn * trans_acc[id],
+      r_sgn = (rot_acc[id] < 0 ? -1 : 1), r_acc = r_sgn * rot_acc[id];
+    trans_vel[id] = limitedVelocity(trans_vel[id], t_sgn,
+				    std::min(t_acc, max_a),
+				    std::min(t_acc, max_d), min_v, max_v, ts);
+    rot_vel[id] = limitedVelocity(rot_vel[id], r_sgn,
+				  std::min(r_acc, max_gm),
+				  std::min(r_acc, max_gd), min_om, max_om,
+				  ts);
+  } // end of for (each robot)
+} // end of void MotionModel::applyAccelerations(double*, ...) -------
@@ -0,0 +1,106 @@
+/**
+ * @file  src/model/planner.cpp
+ *
+ * @brief Parallel planning of many Dubins-like paths.
+ *
+ * @date  October 2026
+ **/
+
+#include <atomic>
+#include <algorithm>
+#include <vector>
+#include <QThread>
+#include <model/connector.hpp>
+#include <model/planner.hpp>
+
+
+/* Thread planning blocks of pairs of configurations, the next block
+ * being shared by all the threads.
+ */
+template<class PathClass>
+class PlanningWorker : public QThread {
+  const PathClass& model;                   // the paths' parameters
+  const iSeeML::rob::OrPtConfig *starts, *goals;
+  const int nb;                             // the number of pairs
+  double* lengths;                          // the outputs
+  iSeeML::rob::DubinsLikePath::Type* types;
+  std::atomic<int>& next;                   // the next block's index
+
+protected:
+  // Main loop of the thread: plans blocks until the end.
+  void run() {
+    static const int block_size = 64;
+    PathConnector<PathClass> connector;
+    PathClass path(model);
+    int first, id, last;
+
+    while ( ( first = next.fetch_add(block_size) ) < nb ) {
+      last = std::min(first + block_size, nb);
+      for(id = first; id < last; id++) {
+	connector.connect(path, starts[id], goals[id]);
+	lengths[id] = path.length();
+	if (types != NULL)
+	  types[id] = path.type();
+      } // end of for (each pair of the block)
+    } // end of while (some blocks remain)
+  } // end of void run()
+
+public:
+  PlanningWorker(const PathClass& mdl,
+		 const iSeeML::rob::OrPtConfig* strts,
+		 const iSeeML::rob::OrPtConfig* gls, const int n,
+		 double* lngths, iSeeML::rob::DubinsLikePath::Type* tps,
+		 std::atomic<int>& nxt)
+    : model(mdl), starts(strts), goals(gls), nb(n), lengths(lngths),
+      types(tps), next(nxt) {}
+
+}; // end of class PlanningWorker -------------------------------------
+
+/* Plans paths between pairs of configurations, in parallel threads.
+ *
+ * Parameter model    a path giving the paths' parameters,
+ *           starts   the starting configurations,
+ *           goals    the goal configurations,
+ *           nb       the number of pairs of configurations,
+ *           lengths  the lengths of the paths (output),
+ *           types    the types of the paths (output, if not NULL).
+ */
+template<class PathClass>
+static void planInThreads(const PathClass& model,
+			  const iSeeML::rob::OrPtConfig* starts,
+			  const iSeeML::rob::OrPtConfig* goals,
+			  const int nb, double* lengths,
+			  iSeeML::rob::DubinsLikePath::Type* types) {
+  const int nb_threads = std::max( 1, QThread::idealThreadCount() );
+  std::vector<PlanningWorker<PathClass>*> workers;
+  std::atomic<int> next(0);
+  int id;
+
+  for(id = 0; id < nb_threads; id++) {
+    workers.push_back( new PlanningWorker<PathClass>
+		       (model, starts, goals, nb, lengths, types, next) );
+    workers.back()->start();
+  } // end of for (each thread)
+  for(id = 0; id < nb_threads; id++) {
+    workers[id]->wait();
+    delete workers[id];
+  } // end of for (each thread)
+} // end of static void planInThreads(const PathClass&, ...) ---------
+
+// Cf BatchPlanner::plan(const iSeeML::rob::FscPath&, ...)
+void BatchPlanner::plan(const iSeeML::rob::FscPath& model,
+			const iSeeML::rob::OrPtConfig* starts,
+			const iSeeML::rob::OrPtConfig* goals, const int nb,
+			double* lengths,
+			iSeeML::rob::DubinsLikePath::Type* types) {
+  planInThreads(model, starts, goals, nb, lengths, types);
+} // end of void BatchPlanner::plan(const iSeeML::rob::FscPath&, ...)
+
+// Cf BatchPlanner::plan(const iSeeML::rob::DubinsPath&, ...)
+void BatchPlanner::plan(const iSeeML::rob::DubinsPath& model,
+			const iSeeML::rob::OrPtConfig* starts,
+			const iSeeML::rob::OrPtConfig* goals, const int nb,
+			double* lengths,
+			iSeeML::rob::DubinsLikePath::Type* types) {
+  planInThreads(model, starts, goals, nb, lengths, types);
+} // end of void BatchPlanner::plan(const iSeeML::rob::DubinsPath&, ...)
@@ -0,0 +1,88 @@
+/**
+ * @file  src/model/realtime.cpp
+ *
+ * @brief Real-time scheduling of a periodic thread.
+ *
+ * @date  October 2026
+ **/
+
+#include <sstream>
+#include <string.h>                 // to get strerror() declaration
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>               // to get mlockall() declaration
+#include <model/realtime.hpp>
+
+
+/* Pre-faults a part of the calling thread's stack: its pages are
+ * then mapped (and locked, after mlockall), and the thread does not
+ * page fault when its stack grows.
+ */
+static void prefaultStack() {
+  static const int size = 256 * 1024;
+  volatile char stack[size];
+
+  for(int id = 0; id < size; id += 4096)
+    stack[id] = 0;
+  (void) stack;  // only written: its pages are now mapped
+} // end of static void prefaultStack() ------------------------------
+
+/* Sets the calling thread in real-time mode.
+ *
+ * Returns a report of the steps, giving the failed ones.
+ */
+std::string RealTimeOptions::setup() const {
+  std::ostringstream report;
+  int error;
+
+  if (cpu >= 0) {  // pinned to the given core
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    report << "core " << cpu << ": "
+	   << (error == 0 ? "OK" : strerror(error)) << "; ";
+  } // end of if (core given)
+  struct sched_param param;
+  param.sched_priority = priority;
+  error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+  report << "SCHED_FIFO " << priority << ": "
+	 << (error == 0 ? "OK" : strerror(error)) << "; ";
+  error = mlockall(MCL_CURRENT | MCL_FUTURE) == 0 ? 0 : errno;
+  report << "memory lock: " << (error == 0 ? "OK" : strerror(error));
+  prefaultStack();
+  return report.str();
+} // end of std::string RealTimeOptions::setup() const ---------------
+
+/* The constructor sets the first deadline a period after now.
+ *
+ * Parameter prd  the period, in seconds.
+ */
+DeadlineTimer::DeadlineTimer(const double& prd) : period(prd * 1E9) {
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  next.tv_nsec += period;
+  next.tv_sec += next.tv_nsec / 1000000000;
+  next.tv_nsec %= 1000000000;
+} // end of DeadlineTimer::DeadlineTimer(const double&) --------------
+
+/* Sleeps until the next deadline, and sets the following one.
+ *
+ * Returns whether the deadline was met.
+ */
+bool DeadlineTimer::sleep() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  const bool met = (now.tv_sec < next.tv_sec)
+    || ( (now.tv_sec == next.tv_sec) && (now.tv_nsec <= next.tv_nsec) );
+
+  if (met)  // (sleep restarted if interrupted by a signal)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL)
+	   == EINTR) ;
+  else  // missed: the next deadline is a period from now
+    next = now;
+  next.tv_nsec += period;
+  next.tv_sec += next.tv_nsec / 1000000000;
+  next.tv_nsec %= 1000000000;
+  return met;
+} // end of bool DeadlineTimer::sleep() ------------------------------
@@ -0,0 +1,174 @@
+/**
+ * @file  src/model/recorder.cpp
+ *
+ * @brief Binary record and replay of a controller's inputs
+ *        and outputs.
+ *
+ * @date  October 2026
+ **/
+
+#include <sstream>
+#include <algorithm>                // to get std::max() declaration
+#include <string.h>                 // to get memcmp() declaration
+#include <math.h>                   // to get fabs() declaration
+#include <model/recorder.hpp>
+
+
+// The magic characters beginning a record file.
+const char MotionRecorder::magic[8] = { 'Q', 'T', 'C', 'R', 'E', 'C',
+					'1', '\n' };
+
+/* Opens a record file, writes its header, and starts the writing
+ * thread.
+ *
+ * Parameter file_name  the name of the file (overwritten),
+ *           time_step  the time step of the recorded controller.
+ *
+ * Returns whether the file could be opened.
+ */
+bool MotionRecorder::open(const char* file_name,
+			  const double& time_step) {
+  close();
+  // the buffer has to be set before opening the file
+  output.rdbuf()->pubsetbuf( buffer, sizeof(buffer) );
+  output.open(file_name, std::ios::out | std::ios::binary
+	      | std::ios::trunc);
+  if ( !output.is_open() )
+    return false;
+  output.write( magic, sizeof(magic) );
+  output.write( (const char*) &time_step, sizeof(time_step) );
+  if ( !output.good() ) {
+    output.close();
+    return false;
+  } // end of if (header not written)
+  open_file = true;
+  stopping.store(false, std::memory_order_release);
+  start();
+  return true;
+} // end of bool MotionRecorder::open(const char*, const double&) ----
+
+// Main loop of the thread: writes the pushed records until the end.
+void MotionRecorder::run() {
+  Record record;
+  bool last_loop;
+
+  do {  // the records pushed before stopping are written
+    last_loop = stopping.load(std::memory_order_acquire);
+    while ( records.pop(record) ) {
+      output.put(record.kind);
+      output.write( (const char*) record.values,
+		    nbValues(record.kind) * sizeof(double) );
+    } // end of while (record to write)
+    if (!last_loop)  // a few cycles of the control loop
+      msleep(20);
+  } while (!last_loop);
+} // end of void MotionRecorder::run() -------------------------------
+
+/* Stops the writing thread, once the pushed records are written,
+ * and closes the file.
+ */
+void MotionRecorder::close() {
+  if (open_file) {
+    stopping.store(true, std::memory_order_release);
+    wait();  // waits for the run() method (other thread) to stop
+    output.close();
+    open_file = false;
+  } // end of if (open file)
+} // end of void MotionRecorder::close() -----------------------------
+
+/* Reads a record file.
+ *
+ * Parameter file_name  the name of the file.
+ *
+ * Returns whether the file could be read.
+ */
+bool MotionReplay::load(const char* file_name) {
+  std::ifstream input(file_name, std::ios::in | std::ios::binary);
+  char header[ sizeof(MotionRecorder::magic) ];
+  Record record;
+
+  records.clear();
+  if ( !input.read( header, sizeof(header) )
+       || memcmp( header, MotionRecorder::magic, sizeof(header) )
+       || !input.read( (char*) &time_step, sizeof(time_step) ) )
+    return false;
+  while ( input.get(record.kind) ) {
+    const int nb = MotionRecorder::nbValues(record.kind);
+    if ( (nb == 0)  // unknown kind: the file is corrupted
+	 || !input.read( (char*) record.values, nb * sizeof(double) ) )
+      break;
+    records.push_back(record);
+  } // end of while (record read)
+  return true;
+} // end of bool MotionReplay::load(const char*) ---------------------
+
+/* Gives the recorded states.
+ *
+ * Parameter states  the recorded states (output).
+ */
+void MotionReplay::states(std::vector<State>& states) const {
+  std::vector<Record>::const_iterator record;
+
+  states.clear();
+  for(record = records.begin(); record != records.end(); record++)
+    if (record->kind == MotionRecorder::stateRecord) {
+      const double *values = record->values;
+      states.push_back( State( values[0], iSeeML::rob::OrPtConfig
+			       (values[1], values[2], values[3]),
+			       values[4], values[5] ) );
+    } // end of if (state's record)
+} // end of void MotionReplay::states(std::vector<State>&) const -----
+
+/* Replays the recording with a controller (the recorded goals are
+ * given to a reaching controller, and ignored by the other ones).
+ *
+ * Parameter ctrl       the controller,
+ *           tolerance  the maximum difference of velocities which is
+ *                      not a difference.
+ *
+ * Returns the comparison of the commands.
+ */
+ReplayResult MotionReplay::run(Controller& ctrl,
+			       const double& tolerance) const {
+  std::vector<Record>::const_iterator record;
+  std::ostringstream log_str;  // logs are ignored
+  double trans_vel, rot_vel;
+  ReplayResult result;
+  // the goals can only be given to a reaching controller
+  ReachingCtrl *reach_ctrl = dynamic_cast<ReachingCtrl*>(&ctrl);
+
+  ctrl.stopMotion();  // as in ROSnode::run()
+  for(record = records.begin(); record != records.end(); record++) {
+    const double *values = record->values;
+    if (record->kind == MotionRecorder::stateRecord)
+      ctrl.newState( State( values[0], iSeeML::rob::OrPtConfig
+			    (values[1], values[2], values[3]),
+			    values[4], values[5] ) );
+    else if (record->kind == MotionRecorder::goalRecord) {
+      if (reach_ctrl != NULL)
+	reach_ctrl->changeGoal( State( values[0], iSeeML::rob::OrPtConfig
+				       (values[1], values[2], values[3]),
+				       values[4], values[5] ) );
+    } else {  // command: chosen again, and compared
+      log_str.str("");
+      ctrl.setCycleTime(values[0]);
+      ctrl.chooseVelocities(trans_vel, rot_vel, log_str);
+      const double trans_diff = fabs(trans_vel - values[1]),
+	rot_diff = fabs(rot_vel - values[2]);
+      if ( (result.first_diff < 0)
+	   && ( (trans_diff > tolerance) || (rot_diff > tolerance) ) )
+	result.first_diff = result.nb_commands;
+      result.max_trans_diff = std::max(result.max_trans_diff,
+				       trans_diff);
+      result.max_rot_diff = std::max(result.max_rot_diff, rot_diff);
+      result.mean_trans_diff += trans_diff;
+      result.mean_rot_diff += rot_diff;
+      result.nb_commands++;
+    } // end of else (command's record)
+  } // end of for (each record)
+  if (result.nb_commands > 0) {
+    result.mean_trans_diff /= result.nb_commands;
+    result.mean_rot_diff /= result.nb_commands;
+  } // end of if (some command)
+  return result;
+} // end of ReplayResult MotionReplay::run(Controller&, ...) const ---
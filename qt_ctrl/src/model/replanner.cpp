@@ -0,0 +1,100 @@
+/**
+ * @file  src/model/replanner.cpp
+ *
+ * @brief Background replanning of FSC paths.
+ *
+ * @date  October 2026
+ **/
+
+#include <model/replanner.hpp>
+
+
+// Main loop of the thread: plans the requested paths until the end.
+void Replanner::run() {
+  QMutexLocker locker(&mutex);
+
+  while (true) {
+    while (!pending && !stopping)
+      requested.wait(&mutex);
+    if (stopping)
+      break;
+    // copy the request, which can be replaced while planning
+    iSeeML::rob::FscPath new_path(path);
+    const iSeeML::rob::OrPtConfig strt = start_conf, gl = goal_conf;
+    const unsigned long nb = request_nb;
+    pending = false;  planning = true;
+    mutex.unlock();
+    connector.connect(new_path, strt, gl);
+    mutex.lock();
+    planning = false;
+    // kept only if it is the last request and short enough
+    if ( (nb == request_nb) && (new_path.length() < max_length) ) {
+      path = new_path;
+      ready = true;
+    } // end of if (path to give)
+    planned.wakeAll();
+  } // end of while (not stopping)
+} // end of void Replanner::run() ------------------------------------
+
+// The destructor stops the planning thread.
+Replanner::~Replanner() {
+  mutex.lock();
+  stopping = true;
+  requested.wakeAll();
+  mutex.unlock();
+  wait();
+} // end of Replanner::~Replanner() ----------------------------------
+
+/* Requests a path, replacing any previous request.
+ *
+ * Parameter model  a FSC path giving the path's parameters,
+ *           strt   the starting configuration,
+ *           gl     the goal configuration,
+ *           max_l  the length that the path should not reach,
+ *           tg     a value given back with the path.
+ */
+void Replanner::request(const iSeeML::rob::FscPath& model,
+			const iSeeML::rob::OrPtConfig& strt,
+			const iSeeML::rob::OrPtConfig& gl,
+			const double& max_l, const double& tg) {
+  QMutexLocker locker(&mutex);
+
+  path = model;  start_conf = strt;  goal_conf = gl;
+  max_length = max_l;  tag = tg;
+  request_nb++;
+  pending = true;  ready = false;
+  requested.wakeAll();
+} // end of void Replanner::request(const iSeeML::rob::FscPath&, ...)
+
+/* Takes the path of the last request, if it is ready.
+ *
+ * Parameter pth     the path, changed only if one is taken,
+ *           tg      the value given with its request (idem),
+ *           budget  the time (in ms) to wait at most for a path
+ *                   (unlimited: until the end of its planning).
+ *
+ * Returns whether a path was taken.
+ */
+bool Replanner::take(iSeeML::rob::FscPath& pth, double& tg,
+		     const unsigned long budget) {
+  QMutexLocker locker(&mutex);
+
+  if (budget == unlimited)  // until the end of the planning
+    while (pending || planning)
+      planned.wait(&mutex);
+  else if ( (pending || planning) && (budget > 0) )
+    planned.wait(&mutex, budget);
+  if (!ready || pending)  // (a planning can end before the last one)
+    return false;
+  pth = path;  tg = tag;
+  ready = false;
+  return true;
+} // end of bool Replanner::take(iSeeML::rob::FscPath&, ...) ---------
+
+// Drops the last request and its path.
+void Replanner::cancel() {
+  QMutexLocker locker(&mutex);
+
+  request_nb++;
+  pending = ready = false;
+} // end of void Replanner::cancel() ---------------------------------
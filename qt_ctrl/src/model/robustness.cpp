@@ -0,0 +1,128 @@
+/**
+ * @file  src/model/robustness.cpp
+ *
+ * @brief Evaluation of a controller over a family of motion models.
+ *
+ * @date  October 2026
+ **/
+
+#include <math.h>                   // to get HUGE_VAL definition
+#include <algorithm>                // to get std::max() declaration
+#include <QThread>
+#include <model/robustness.hpp>
+
+
+/* Thread computing the costs of some of the motion models: the ones
+ * whose index is the thread's one modulo the number of threads.
+ */
+class RobustnessWorker : public QThread {
+  const RobustnessEval& eval;               // the evaluation
+  const std::vector<MotionModel>& models;   // all the models
+  std::vector<double>& costs;               // all the costs
+  const int first, nb_threads;              // models' selection
+
+protected:
+  // Main loop of the thread: one simulation for each model.
+  void run() {
+    const int nb_models = models.size();
+    for(int id = first; id < nb_models; id += nb_threads)
+      costs[id] = eval.cost(models[id]);
+  }
+
+public:
+  RobustnessWorker(const RobustnessEval& ev,
+		   const std::vector<MotionModel>& mdls,
+		   std::vector<double>& csts, const int id, const int nb)
+    : eval(ev), models(mdls), costs(csts), first(id), nb_threads(nb)
+  {}
+
+}; // end of class RobustnessWorker -----------------------------------
+
+/* Gives the cost of one motion model (in this thread).
+ *
+ * Parameter model  the motion model.
+ *
+ * Returns the cost of the motion model.
+ */
+double RobustnessEval::cost(const MotionModel& model) const {
+  Controller* ctrl = make_ctrl(model);
+  if (ctrl == NULL)
+    return HUGE_VAL;
+  const Simulator simulator(model, nb_substeps);
+  std::vector<State> traject;
+  simulator.run(*ctrl, initial, duration, traject);
+  delete ctrl;  // in the thread which created it
+  return Simulator::distance(reference, traject);
+} // end of double RobustnessEval::cost(const MotionModel&) const ----
+
+/* Gives the cost of each motion model, simulations being run
+ * in parallel threads.
+ *
+ * Parameter models  the motion models,
+ *           costs   the cost of each motion model (output).
+ */
+void RobustnessEval::evaluate(const std::vector<MotionModel>& models,
+			      std::vector<double>& costs) const {
+  const int nb_models = models.size(),
+    nb_threads = std::max( 1, std::min(nb_models,
+				       QThread::idealThreadCount()) );
+  std::vector<RobustnessWorker*> workers;
+  int id;
+
+  costs.assign(nb_models, HUGE_VAL);
+  for(id = 0; id < nb_threads; id++) {
+    workers.push_back( new RobustnessWorker(*this, models, costs,
+					    id, nb_threads) );
+    workers.back()->start();
+  } // end of for (each thread)
+  for(id = 0; id < nb_threads; id++) {
+    workers[id]->wait();
+    delete workers[id];
+  } // end of for (each thread)
+} // end of void RobustnessEval::evaluate(...) const -----------------
+
+/* Gives the cost of a family of motion models.
+ *
+ * Parameter models     the motion models,
+ *           criterion  the way to combine the models' costs.
+ *
+ * Returns the worst or the expected cost.
+ */
+double RobustnessEval::cost(const std::vector<MotionModel>& models,
+			    const Criterion& criterion) const {
+  std::vector<double> costs;
+  double res = 0;
+
+  evaluate(models, costs);
+  for(std::vector<double>::const_iterator cost = costs.begin();
+      cost != costs.end(); cost++)
+    if (criterion == worstCost)
+      res = std::max(res, *cost);
+    else
+      res += *cost;
+  return (criterion == worstCost) || costs.empty() ? res
+    : res / costs.size();
+} // end of double RobustnessEval::cost(const std::vector<...>&, ...)
+
+/* Gives a family of motion models around a nominal one: velocity
+ * and acceleration limits are multiplied by one minus the ratio, one,
+ * and one plus the ratio (nine models, the first being the nominal).
+ *
+ * Parameter nominal  the nominal motion model,
+ *           ratio    the ratio of the perturbations.
+ *
+ * Returns the perturbed motion models.
+ */
+std::vector<MotionModel>
+RobustnessEval::perturbedModels(const MotionModel& nominal,
+				const double& ratio) {
+  static const int nb_factors = 3;
+  const double factors[nb_factors] = {1, 1 - ratio, 1 + ratio};
+  std::vector<MotionModel> models;
+
+  for(int vel_id = 0; vel_id < nb_factors; vel_id++)
+    for(int acc_id = 0; acc_id < nb_factors; acc_id++)
+      models.push_back( nominal.scaled(factors[vel_id],
+				       factors[acc_id]) );
+  return models;
+} // end of std::vector<MotionModel> RobustnessEval::perturbedModels()
@@ -0,0 +1,216 @@
+/**
+ * @file  src/model/simulator.cpp
+ *
+ * @brief Headless simulator of the robot's motion.
+ *
+ * @date  October 2026
+ **/
+
+#include <math.h>                   // to get cos() declaration
+#include <fstream>
+#include <algorithm>                // to get std::min() declaration
+#include <model/simulator.hpp>
+
+
+/* Gives the configuration's change during a time step, in the frame
+ * of the initial configuration, for linearly changing velocities.
+ *
+ * The change is the integral of v(t) exp(i theta(t)), v being linear
+ * and theta quadratic: it is computed in closed form if the rotation 
+ * velocity is constant, by a Gauss-Legendre quadrature otherwise.
+ *
+ * Parameter init_trans  the initial translation velocity,
+ *           init_rot    the initial  rotation   velocity,
+ *           trans_vel   the final translation velocity,
+ *           rot_vel     the final  rotation   velocity,
+ *           time_step   the duration of the step,
+ *           dx          the first  coordinate's change (output),
+ *           dy          the second coordinate's change (output).
+ */
+void SimulatorBase::exactMotion(const double& init_trans,
+				const double& init_rot,
+				const double& trans_vel,
+				const double& rot_vel,
+				const double& time_step,
+				double& dx, double& dy) {
+  // nodes and weights of the Gauss-Legendre quadrature, on [-1, 1]
+  static const int nb_nodes = 4;
+  static const double node[nb_nodes] =
+    { -0.8611363115940526, -0.3399810435848563,
+      0.3399810435848563, 0.8611363115940526 },
+    weight[nb_nodes] = { 0.3478548451374538, 0.6521451548625461,
+			 0.6521451548625461, 0.3478548451374538 };
+  const double& T = time_step, &v0 = init_trans, &om = init_rot,
+    acc = (trans_vel - init_trans) / T, rot_acc = (rot_vel - om) / T,
+    phi = om * T;  // orientation's change for constant rotation
+
+  if (fabs(rot_acc) * T * T > 1E-12) { // rotation velocity changes:
+    dx = dy = 0;                        // quadrature
+    for(int id = 0; id < nb_nodes; id++) {
+      const double t = T * (1 + node[id]) / 2,
+	w = weight[id] * T / 2 * (v0 + acc * t),
+	theta = (om + rot_acc * t / 2) * t;
+      dx += w * cos(theta);
+      dy += w * sin(theta);
+    } // end of for (each node)
+  } // end of if (rotation velocity changes)
+  else if (fabs(phi) < 1E-3) {  // (almost) a line segment: moments
+    const double m0 = (v0 + acc * T / 2) * T,              // of the
+      m1 = (v0 / 2 + acc * T / 3) * T * T,            // translation
+      m2 = (v0 / 3 + acc * T / 4) * T * T * T;    // velocity, for a
+    dx = m0 - om * om * m2 / 2;          // second order expansion
+    dy = om * m1;                         // of the exponential
+  }
+  else { // circular arc (if constant translation velocity): exact
+    const double c = cos(phi), s = sin(phi), v1 = v0 + acc * T;
+    dx = ( v1 * s + acc * (c - 1) / om ) / om;
+    dy = ( v0 - v1 * c + acc * s / om ) / om;
+  } // end of else (circular arc)
+} // end of void SimulatorBase::exactMotion(const double&, ...) ------
+
+/* Gives the state of the robot one time step later, knowing its
+ * velocities at the end of the step (they change linearly).
+ * The configuration is integrated precisely, or with an Euler scheme
+ * if substeps are defined.
+ *
+ * Parameter state      the current state of the robot,
+ *           trans_vel  the final translation velocity,
+ *           rot_vel    the final  rotation   velocity,
+ *           time_step  the duration of the step.
+ *
+ * Returns the state of the robot at the end of the step.
+ */
+State SimulatorBase::integrate(const State& state,
+			       const double& trans_vel,
+			       const double& rot_vel,
+			       const double& time_step) const {
+  const double init_trans = state.translationVelocity(),
+    init_rot = state.rotationVelocity();
+  const iSeeML::rob::OrPtConfig& q = state.configuration();
+  double x = q.position().xCoord(), y = q.position().yCoord(),
+    theta = q.orientation();
+  if (nb_substeps == 0) { // precise motion, in the initial frame
+    double dx, dy;
+    exactMotion(init_trans, init_rot, trans_vel, rot_vel, time_step,
+		dx, dy);
+    x += dx * cos(theta) - dy * sin(theta);
+    y += dx * sin(theta) + dy * cos(theta);
+    theta += (init_rot + rot_vel) * time_step / 2;
+  } // end of if (precise motion)
+  else { // Euler integration
+    const double dt = time_step / nb_substeps,
+      d_trans = (trans_vel - init_trans) / nb_substeps,
+      d_rot = (rot_vel - init_rot) / nb_substeps;
+    for(int id = 0; id < nb_substeps; id++) {
+      // velocities in the middle of the substep
+      const double v = init_trans + (id + .5) * d_trans,
+	om = init_rot + (id + .5) * d_rot;
+      x += v * cos(theta) * dt;
+      y += v * sin(theta) * dt;
+      theta += om * dt;
+    } // end of for (each substep)
+  } // end of else (Euler integration)
+
+  return State( state.date() + time_step,
+		iSeeML::rob::OrPtConfig(x, y, theta),
+		trans_vel, rot_vel );
+} // end of State SimulatorBase::integrate(const State&, ...) const --
+
+/* Gives the state of the robot one time step later, its velocities
+ * changing of sign during the step: the step is split at the dates
+ * of their null values, and each part is integrated with linear
+ * velocities.
+ *
+ * Parameter state       the current state of the robot,
+ *           trans_vel   the final translation velocity,
+ *           rot_vel     the final  rotation   velocity,
+ *           time_step   the duration of the step,
+ *           trans_stop  the date of the null translation velocity,
+ *                       or the time step if it keeps its sign,
+ *           rot_stop    idem for the rotation velocity.
+ *
+ * Returns the state of the robot at the end of the step.
+ */
+State SimulatorBase::integrate(const State& state,
+			       const double& trans_vel,
+			       const double& rot_vel,
+			       const double& time_step,
+			       const double& trans_stop,
+			       const double& rot_stop) const {
+  if ( (trans_stop >= time_step) && (rot_stop >= time_step) )
+    return integrate(state, trans_vel, rot_vel, time_step);
+  const double init_vel[2] = { state.translationVelocity(),
+			       state.rotationVelocity() },
+    final_vel[2] = {trans_vel, rot_vel},
+    stop[2] = {trans_stop, rot_stop},
+    // the dates splitting the step, in increasing order
+    dates[3] = { std::min(trans_stop, rot_stop),
+		 std::max(trans_stop, rot_stop), time_step };
+  State current(state);
+  double start = 0, vel[2];
+
+  for(int id = 0; id < 3; id++)
+    if (dates[id] > start) {  // (parts of null duration are skipped)
+      for(int v_id = 0; v_id < 2; v_id++)  // velocities at this date
+	vel[v_id] = stop[v_id] >= time_step ? init_vel[v_id]
+	  + (final_vel[v_id] - init_vel[v_id]) * dates[id] / time_step
+	  : dates[id] <= stop[v_id] ?
+	  init_vel[v_id] * (1 - dates[id] / stop[v_id])
+	  : final_vel[v_id] * (dates[id] - stop[v_id])
+	  / (time_step - stop[v_id]);
+      current = integrate(current, vel[0], vel[1], dates[id] - start);
+      start = dates[id];
+    } // end of if (part of the step)
+  // (avoiding rounding errors on the date and on the velocities)
+  return State( state.date() + time_step, current.configuration(),
+		trans_vel, rot_vel );
+} // end of State SimulatorBase::integrate(const State&, ...) const --
+
+/* Gives the distance between two trajectories: the sum of
+ * the distances between their positions of same index, missing
+ * positions being at the origin (as in PID/PID.py).
+ *
+ * Parameter traject1  the first trajectory,
+ *           traject2  the second trajectory.
+ *
+ * Returns the distance between the trajectories.
+ */
+double SimulatorBase::distance(const std::vector<State>& traject1,
+			   const std::vector<State>& traject2) {
+  static const iSeeML::geom::Point origin;
+  const int size1 = traject1.size(), size2 = traject2.size(),
+    size = size1 > size2 ? size1 : size2;
+  double dist = 0;
+
+  for(int id = 0; id < size; id++)
+    dist += ( id < size1 ?
+	      traject1[id].configuration().position() : origin )
+      .distance( id < size2 ?
+		 traject2[id].configuration().position() : origin );
+  return dist;
+} // end of double SimulatorBase::distance(const std::vector<State>&, ...)
+
+/* Reads a trajectory from a file, in the format of the output files.
+ *
+ * Parameter file_name  the name of the file,
+ *           traject    the trajectory read (output).
+ *
+ * Returns whether the file could be opened.
+ */
+bool SimulatorBase::readTrajectory(const char* file_name,
+			       std::vector<State>& traject) {
+  std::ifstream input(file_name);
+  double t, x, y, th, v, om;
+  std::string end_line;
+
+  traject.clear();
+  if ( !input.is_open() )
+    return false;
+  std::getline(input, end_line);  // skip first line
+  while (input >> t >> x >> y >> th >> v >> om) {
+    traject.push_back( State(t, iSeeML::rob::OrPtConfig(x, y, th),
+			     v, om) );
+    std::getline(input, end_line);  // skip the rest of the line
+  } // end of while (line read)
+  return true;
+} // end of bool SimulatorBase::readTrajectory(const char*, ...) -
@@ -0,0 +1,64 @@
+/**
+ * @file  src/model/velocityProfile.cpp
+ *
+ * @brief Velocity profile along a path.
+ *
+ * @date  October 2026
+ **/
+
+#include <algorithm>
+#include <math.h>                   // to get sqrt() declaration
+#include <model/velocityProfile.hpp>
+
+
+/* Computes the profile along the given path.
+ *
+ * Parameter path   the path,
+ *           model  the motion model of the robot,
+ *           ds     the arc length between two samples.
+ */
+void VelocityProfile::compute(const iSeeML::rob::CompoundPath& path,
+			      const MotionModel& model, const double& ds) {
+  const double max_vel = model.maxTranslVel(),
+    max_rot_vel = model.maxRotVel(),
+    max_rot_acc = std::min( model.maxRotAcc(), - model.minRotAcc() ),
+    len = path.length();
+  // last sample at the end of the path (or just before it)
+  const int nb = (int) ceil(len / ds) + 1;
+  int i;
+
+  max_acc = model.maxTranslAcc();  max_dec = - model.minTranslAcc();
+  step = nb > 1 ? len / (nb - 1) : 1;
+  // the samples' buffers keep their capacity
+  arc_lengths.resize(nb);  x.resize(nb);  y.resize(nb);
+  theta.resize(nb);  kappa.resize(nb);
+  for(i = 0; i < nb; i++)
+    arc_lengths[i] = i * step;
+  // path's length is a little bit too much (seg. fault): - 10⁻⁶
+  arc_lengths[nb - 1] = std::max(len - 1E-6, 0.);
+  path.sample(&arc_lengths[0], nb, &x[0], &y[0], &theta[0], &kappa[0]);
+  // === bounds of each sample =======================================
+  velocities.resize(nb);
+  for(i = 0; i < nb; i++) {
+    double vel = max_vel, curv = fabs(kappa[i]), deriv = 0;
+    if (curv * vel > max_rot_vel)  // rotation velocity = curv. * vel.
+      vel = max_rot_vel / curv;
+    if (nb > 1)  // rotation acc. = curvature's derivative * vel.²
+      deriv = fabs( kappa[i < nb - 1 ? i + 1 : i]
+		    - kappa[i > 0 ? i - 1 : i] )
+	/ ( step * ( (i > 0) + (i < nb - 1) ) );
+    if (deriv * vel * vel > max_rot_acc)
+      vel = sqrt(max_rot_acc / deriv);
+    velocities[i] = vel;
+  } // end of for (each sample)
+  // === forward pass: start at rest, accelerate =====================
+  velocities[0] = 0;
+  for(i = 1; i < nb; i++)
+    velocities[i] = std::min( velocities[i], sqrt( velocities[i - 1]
+		    * velocities[i - 1] + 2 * max_acc * step ) );
+  // === backward pass: stop at the end, decelerate ==================
+  velocities[nb - 1] = 0;
+  for(i = nb - 2; i >= 0; i--)
+    velocities[i] = std::min( velocities[i], sqrt( velocities[i + 1]
+		    * velocities[i + 1] + 2 * max_dec * step ) );
+} // end of void VelocityProfile::compute(const ...&, ...) -----------